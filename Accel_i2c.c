@@ -43,6 +43,43 @@ I2Cerror i2cReadSlaveRegister(unsigned char devAddW, unsigned char regAdd, unsig
     return OK;
 }
 
+// One START/RESTART/STOP for the whole block: every byte but the last is
+// ACKed so the slave keeps sending from its auto-incremented address.
+I2Cerror i2cReadSlaveRegisters(unsigned char devAddW, unsigned char regAdd, unsigned char *buf, unsigned char count)
+{
+    i2c1_driver_start();
+    if(_i2cMasterSend(devAddW) == NACK)
+    {
+        i2c1_driver_stop();
+        return BAD_ADDR;
+    }
+    if(_i2cMasterSend(regAdd) == NACK)
+    {
+        i2c1_driver_stop();
+        return BAD_REG;
+    }
+
+    i2c1_driver_restart();
+    if(_i2cMasterSend(devAddW | 1) == NACK)
+    {
+        i2c1_driver_stop();
+        return BAD_ADDR;
+    }
+
+    while(count--)
+    {
+        i2c1_driver_startRX();
+        i2c1_driver_waitRX();
+        *buf++ = i2c1_driver_getRXData();
+        if(count)
+            i2c1_driver_sendACK();
+        else
+            i2c1_driver_sendNACK();
+    }
+    i2c1_driver_stop();
+    return OK;
+}
+
 I2Cerror i2cWriteSlave(unsigned char devAddW, unsigned char regAdd, unsigned char data)
 {
     i2c1_driver_start();
@@ -0,0 +1,39 @@
+/*
+ * File:   Accel_rate.h
+ *
+ * ADXL345 output data rate for the pedometer, and what the current rate
+ * costs in sensor current and I2C bus time.
+ */
+
+#ifndef ACCEL_RATE_H
+#define ACCEL_RATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Output data rates the pedometer uses; all fit one drain a second
+typedef enum
+{
+    ACCEL_RATE_6HZ25,
+    ACCEL_RATE_12HZ5,
+    ACCEL_RATE_25HZ,
+    ACCEL_RATE_COUNT
+} ACCEL_RATE_t;
+
+typedef struct
+{
+    ACCEL_RATE_t rate;
+    bool lowPower;
+    uint16_t centiHz;           // output data rate
+    uint16_t bandwidthCentiHz;  // always half the output data rate
+    uint8_t sensorMicroamps;
+    uint16_t busBytesPerSecond; // I2C bytes on the wire, addresses included
+    uint8_t busPermille;        // share of the 100 kHz bus those bytes take
+} ACCEL_LOAD_t;
+
+// Sets BW_RATE and the FIFO watermark; false for a rate without low power mode
+bool setAccelRate(ACCEL_RATE_t rate, bool lowPower);
+// Estimates for the current rate and whether the pedometer is running
+void getAccelLoad(ACCEL_LOAD_t *load);
+
+#endif /* ACCEL_RATE_H */
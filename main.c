@@ -9,7 +9,13 @@
 #include "oledDriver/oledC.h"
 #include "oledDriver/oledC_colors.h"
 #include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_fonts.h"
+#include "oledDriver/oledC_shadow.h"
+#include "oledDriver/oledC_scanline.h"
+#include "oledDriver/oledC_sprite.h"
+#include "oledDriver/oledC_displayList.h"
 #include "Accel_i2c.h"
+#include "Accel_rate.h"
 #include <libpic30.h>
 #include <xc.h>
 
@@ -21,11 +27,48 @@
 
 // ---------------- Defines ----------------
 #define WRITE_ADDRESS 0x3A
+#define REG_THRESH_TAP 0x1D
+#define REG_DUR 0x21
+#define REG_LATENT 0x22
+#define REG_WINDOW 0x23
+#define REG_THRESH_ACT 0x24
+#define REG_THRESH_INACT 0x25
+#define REG_TIME_INACT 0x26
+#define REG_ACT_INACT_CTL 0x27
+#define REG_TAP_AXES 0x2A
+#define REG_BW_RATE 0x2C
 #define REG_POWER_CTL 0x2D
-#define REG_DATAX0 0x32
-#define REG_DATAY0 0x34
-#define REG_DATAZ0 0x36
+#define REG_INT_ENABLE 0x2E
+#define REG_INT_MAP 0x2F
+#define REG_DATA_FORMAT 0x31
+#define REG_INT_SOURCE 0x30
+#define REG_DATAX0 0x32   // X0, X1, Y0, Y1, Z0, Z1
+#define REG_FIFO_CTL 0x38
+#define REG_FIFO_STATUS 0x39
 #define MEASURE_MODE 0x08
+#define LINK_ACT_INACT 0x20
+#define FULL_RES_16G 0x0B
+#define LOW_POWER 0x10
+#define FIFO_BYPASS 0x00
+#define FIFO_STREAM 0x80
+#define FIFO_DEPTH 32
+#define ACT_THRESHOLD 4      // 62.5 mg/LSB, 0.25 g
+#define INACT_THRESHOLD 3    // 0.19 g
+#define INACT_SECONDS 5
+#define ACT_INACT_AC_XYZ 0xFF // both ac-coupled, all axes
+#define TAP_THRESHOLD 48      // 62.5 mg/LSB, 3 g
+#define TAP_DURATION 32       // 625 us/LSB, 20 ms
+#define TAP_LATENCY 80        // 1.25 ms/LSB, 100 ms
+#define TAP_WINDOW 200        // 1.25 ms/LSB, 250 ms
+#define TAP_AXES_XYZ 0x07
+#define TAP_RATE_100HZ 0x0A
+#define TAP_POLL_PASSES 4     // page passes of 50 ms between reads
+#define TAP_DECIDE_POLLS 2    // reads after a single tap before it counts
+#define INT_SINGLE_TAP 0x40
+#define INT_DOUBLE_TAP 0x20
+#define INT_ACTIVITY 0x10
+#define INT_INACTIVITY 0x08
+#define INT_WATERMARK 0x02
 #define HISTORY_SIZE 60
 #define STEP_THRESHOLD 500.0f
 
@@ -56,6 +99,28 @@ typedef struct
     int16_t x, y, z;
 } ACCEL_DATA_t;
 
+typedef enum
+{
+    TAP_NONE,
+    TAP_SINGLE,
+    TAP_DOUBLE
+} TAP_EVENT_t;
+
+typedef struct
+{
+    uint8_t code;           // BW_RATE rate bits
+    uint16_t centiHz;       // output data rate in 0.01 Hz
+    uint8_t watermark;      // samples in 0.8 s
+    uint8_t normalMicroamps;
+    uint8_t lowPowerMicroamps; // 0 when low power mode is not available
+} ACCEL_RATE_INFO_t;
+
+// Supply current from the ADXL345 datasheet at 2.5 V
+static const ACCEL_RATE_INFO_t accelRates[ACCEL_RATE_COUNT] = {
+    {0x06, 625, 5, 45, 0},
+    {0x07, 1250, 10, 50, 34},
+    {0x08, 2500, 20, 60, 40}};
+
 // ---------------- Globals for Pedometer & Clock ----------------
 static bool wasAboveThreshold = false;
 static bool movementDetected = false;
@@ -64,6 +129,16 @@ static uint8_t inactivityCounter = 0;
 const float baselineGravity = 1024.0f;
 volatile uint8_t stepsHistory[HISTORY_SIZE] = {0};
 static uint8_t currentSecondIndex = 0;
+// Set by Timer1, the main loop then services the accelerometer
+static volatile bool accelDue = false;
+static ACCEL_RATE_t accelRate = ACCEL_RATE_12HZ5;
+static bool accelLowPower = false;
+// Events read from INT_SOURCE but not handled yet. Reading INT_SOURCE
+// clears activity, inactivity and taps alike, so each reader keeps the
+// others' events here.
+static uint8_t accelEvents = 0;
+static uint8_t tapPasses = 0;
+static uint8_t tapSingleWait = 0;
 // For smoothing the displayed pace
 static float displayedPace = 0.0f;
 // Global seconds counter (updated every Timer1 interrupt)
@@ -91,6 +166,12 @@ bool inMenu = false;
 uint8_t stepRateHistory[GRAPH_HISTORY_SIZE] = {0};
 static uint8_t graphIndex = 0;  // Index to track the current second
 bool inGraphMode = false; // Are we currently in the “Graph” sub-page?
+// Point lists for the graph shapes (grid dots, axis ticks, data)
+static uint8_t graphGridX[90], graphGridY[90];
+static uint8_t graphTickX[30], graphTickY[30];
+static uint8_t graphDataX[GRAPH_HISTORY_SIZE], graphDataY[GRAPH_HISTORY_SIZE];
+static char graphLabels[3][4];
+static shape_t graphShapes[8];
 
 // ---------------- Function declaration to avoid implicit warnings ----------------
 void updateMenuClock(void);
@@ -98,20 +179,28 @@ void drawTimeFormatSubpage(void);
 void drawSetTimeMenuBase(void);
 void drawSetTimeStatus(void);
 void handleSetTimeInput(void);
-bool detectTiltForSave(void);
 void drawSetDateStatus(void);
 
 // ---------------- Foot Bitmaps (16×16) ----------------
-static const uint16_t foot1Bitmap[16] = {
-    0x7800, 0xF800, 0xFC00, 0xFC00,
-    0xFC00, 0x7C1E, 0x783E, 0x047F,
-    0x3F9F, 0x1F3E, 0x0C3E, 0x003E,
-    0x0004, 0x00F0, 0x01F0, 0x00E0};
-static const uint16_t foot2Bitmap[16] = {
-    0x001E, 0x003F, 0x003F, 0x007F,
-    0x003F, 0x383E, 0x7C1E, 0x7E10,
-    0x7E7C, 0x7E78, 0x7C30, 0x3C00,
-    0x2000, 0x1E00, 0x1F00, 0x0E00};
+// One row of each frame per entry; the compiler folds the XOR delta table.
+#define FOOT_ROWS(ROW) \
+    ROW(0x7800, 0x001E) ROW(0xF800, 0x003F) ROW(0xFC00, 0x003F) ROW(0xFC00, 0x007F) \
+    ROW(0xFC00, 0x003F) ROW(0x7C1E, 0x383E) ROW(0x783E, 0x7C1E) ROW(0x047F, 0x7E10) \
+    ROW(0x3F9F, 0x7E7C) ROW(0x1F3E, 0x7E78) ROW(0x0C3E, 0x7C30) ROW(0x003E, 0x3C00) \
+    ROW(0x0004, 0x2000) ROW(0x00F0, 0x1E00) ROW(0x01F0, 0x1F00) ROW(0x00E0, 0x0E00)
+#define FOOT1_ROW(a, b) a,
+#define FOOT2_ROW(a, b) b,
+#define FOOT_DELTA_ROW(a, b) (a) ^ (b),
+static const uint16_t foot1Bitmap[16] = { FOOT_ROWS(FOOT1_ROW) };
+static const uint16_t foot2Bitmap[16] = { FOOT_ROWS(FOOT2_ROW) };
+static const uint16_t footDelta[16] = { FOOT_ROWS(FOOT_DELTA_ROW) };
+static const oledc_bitmap_t footFrames[2] = {
+    { foot1Bitmap, OLEDC_BITMAP_ROW16, 16, 16, false },
+    { foot2Bitmap, OLEDC_BITMAP_ROW16, 16, 16, false }};
+static const oledc_bitmap_t footDeltas[2] = {
+    { footDelta, OLEDC_BITMAP_ROW16, 16, 16, false },
+    { footDelta, OLEDC_BITMAP_ROW16, 16, 16, false }};
+static oledc_sprite_t footSprite;
 
 // ---------------- Functions for Graph ----------------
 volatile uint8_t timeDifference = 0;
@@ -141,89 +230,80 @@ void drawMenu(void);
 // Draw Step Rate Graph on OLED
 void drawStepRateGraph(void) {
     inGraphMode = true;  // Enter graph mode
-    oledC_clearScreen();  // Clear screen before drawing
-
-    // int step_rate_history[90] = {
-    //     30, 35, 40, 50, 60, 65, 70, 75, 80, 85, 
-    //     90, 100, 95, 90, 85, 80, 75, 70, 65, 60, 
-    //     55, 50, 55, 60, 65, 70, 80, 85, 90, 85, 
-    //     80, 75, 70, 60, 55, 50, 45, 40, 35, 30, 
-    //     25, 20, 15, 10, 12, 15, 20, 25, 30, 35, 
-    //     40, 45, 50, 55, 60, 70, 75, 80, 85, 90, 
-    //     95, 90, 80, 75, 70, 65, 60, 55, 50, 45, 
-    //     40, 35, 30, 25, 20, 15, 10, 15, 20, 25, 
-    //     30, 35, 40, 45, 50, 55, 60, 70, 75, 80, 
-    //     85, 90, 95, 100, 95, 90, 85, 80, 75, 70
-    // };
+    shape_params_t params;
+    uint8_t n = 0;
 
     // Drawing the X axis (time axis)
-    oledC_DrawLine(20, GRAPH_HEIGHT, GRAPH_WIDTH, GRAPH_HEIGHT, 1, 0xFFFF); // Horizontal line for X-axis
-
-    // Draw horizontal grid lines at 30, 60, and 100 steps
+    params.line.color = 0xFFFF;
+    params.line.xs = 20;
+    params.line.ys = GRAPH_HEIGHT;
+    params.line.xe = GRAPH_WIDTH;
+    params.line.ye = GRAPH_HEIGHT;
+    params.line.width = 1;
+    oledC_createShape(OLED_SHAPE_LINE, &params, &graphShapes[n++]);
+
+    // Horizontal grid lines at 30, 60, and 100 steps
     int step_values[] = {0, 30, 60, 100};
     int min_y = GRAPH_HEIGHT; 
     int max_y = 10; 
 
     // Add labels to Y axis (step rate)
     for (int i = 1; i < 4; i++) {
-        // int y_pos = GRAPH_HEIGHT - 10 - (step_values[i] * (GRAPH_HEIGHT - 20) / 100);
         int y_pos = min_y - ((step_values[i] * (min_y - max_y)) / 100);
-        char label[4];
-        sprintf(label, "%d", step_values[i]);
-        // oledC_DrawString(0, y_pos - 4, 1, 1, label, 0xFFFF); 
-        oledC_DrawString(0, y_pos - 4, 1, 1, (uint8_t *)label, 0xFFFF); // Cast char* to uint8_t*
-
-        // Draw horizontal dotted grid line at this Y-position
+        sprintf(graphLabels[i - 1], "%d", step_values[i]);
+        params.string.color = 0xFFFF;
+        params.string.x = 0;
+        params.string.y = y_pos - 4;
+        params.string.scale_x = 1;
+        params.string.scale_y = 1;
+        params.string.string = (uint8_t *)graphLabels[i - 1];
+        params.string.font = NULL;
+        oledC_createShape(OLED_SHAPE_STRING, &params, &graphShapes[n++]);
+
+        // Dotted grid line at this Y-position
         for (int j = 0; j < 30; j++) { 
-            int x_pos = 20 + (j * (GRAPH_WIDTH - 20) / 29); 
-            oledC_DrawPoint(x_pos, y_pos, 0xFFFF);
+            graphGridX[(i - 1) * 30 + j] = 20 + (j * (GRAPH_WIDTH - 20) / 29);
+            graphGridY[(i - 1) * 30 + j] = y_pos;
         }
     }
 
-    // Draw X-axis as small dots for 90 seconds
+    // X-axis ticks for the 90 seconds, the 3-pixel shape of a width-1 thick point
     for (int i = 0; i <= 9; i++) {
         int x_pos = 20 + (i * (GRAPH_WIDTH - 20) / 9);
-        oledC_DrawThickPoint(x_pos, GRAPH_HEIGHT - 2, 1.5, 0xFFFF);
+        graphTickX[i * 3] = x_pos - 1;
+        graphTickY[i * 3] = GRAPH_HEIGHT - 2;
+        graphTickX[i * 3 + 1] = x_pos;
+        graphTickY[i * 3 + 1] = GRAPH_HEIGHT - 3;
+        graphTickX[i * 3 + 2] = x_pos;
+        graphTickY[i * 3 + 2] = GRAPH_HEIGHT - 2;
     }
 
-    // // Plot the fake step rate history
-    // for (int i = 0; i < 90; i++) {
-    //     // Calculate the X position based on the second (i represents the second)
-    //     int x_pos = 20 + (i * (GRAPH_WIDTH - 20) / 89); 
-
-    //     // Map the step rate value (0 to 100) to the Y-axis (invert the Y calculation)
-    //     int y_pos = min_y - (step_rate_history[i] * (min_y - max_y) / 100);
-
-    //     // Plot the step rate history as a point
-    //     oledC_DrawPoint(x_pos, y_pos, 0xFFFF);
-    // }
-
     for (int i = 0; i < 90; i++) {
         // Calculate the X position based on the second (i represents the second)
-        int x_pos = 20 + (i * (GRAPH_WIDTH - 20) / 89); 
+        graphDataX[i] = 20 + (i * (GRAPH_WIDTH - 20) / 89); 
 
         // Map the step rate value (0 to 100) to the Y-axis (invert the Y calculation)
-        int y_pos = min_y - (stepRateHistory[i] * (min_y - max_y) / 100);
-
-        // Plot the step rate history as a point
-        oledC_DrawPoint(x_pos, y_pos, 0xFFFF);
+        graphDataY[i] = min_y - (stepRateHistory[i] * (min_y - max_y) / 100);
     }
 
-    // Plot the real step rate history (from the accelerometer)
-    // for (int i = 0; i < GRAPH_HISTORY_SIZE; i++) {
-    //     int y_pos = GRAPH_HEIGHT - (stepRateHistory[i] * GRAPH_HEIGHT / 100);
-
-    //     // Map the time (0 to 89 seconds) to the X-axis
-    //     int x_pos = 20 + (i * (GRAPH_WIDTH - 20) / (GRAPH_HISTORY_SIZE - 1));  // Spread over the 90 seconds
-
-    //     // Plot the data point on the graph (white point for steps)
-    //     oledC_DrawPoint(x_pos, y_pos, 0xFFFF);  // Plot a white point at (x_pos, y_pos)
-
-    //     // int x_pos = 20 + (i * (GRAPH_WIDTH - 20) / (GRAPH_HISTORY_SIZE - 1));  // 90 seconds, 89 intervals
-    //     // int y_pos = min_y - (stepRateHistory[i] * (min_y - max_y) / 100);  // Map the step rate value (0 to 100) to the Y-axis
-
-    //     // oledC_DrawPoint(x_pos, y_pos, 0xFFFF);  // Plot the step rate history as a point
-    // }
+    params.points.color = 0xFFFF;
+    params.points.x = graphGridX;
+    params.points.y = graphGridY;
+    params.points.count = sizeof(graphGridX);
+    oledC_createShape(OLED_SHAPE_POINTS, &params, &graphShapes[n++]);
+    params.points.x = graphTickX;
+    params.points.y = graphTickY;
+    params.points.count = sizeof(graphTickX);
+    oledC_createShape(OLED_SHAPE_POINTS, &params, &graphShapes[n++]);
+    params.polyline.color = 0xFFFF;
+    params.polyline.x = graphDataX;
+    params.polyline.y = graphDataY;
+    params.polyline.count = sizeof(graphDataX);
+    params.polyline.width = 1;
+    oledC_createShape(OLED_SHAPE_POLYLINE, &params, &graphShapes[n++]);
+
+    // The whole page, background included, goes out in one window burst.
+    oledC_scanlineRender(NULL, graphShapes, n, OLEDC_COLOR_BLACK);
 
     bool s1WasPressed = false;
     bool s2WasPressed = false;
@@ -251,35 +331,88 @@ void drawStepRateGraph(void) {
 // ---------------- Functions for Pedometer, Clock, etc. ----------------
 void errorStop(char *msg)
 {
-    // oledC_DrawString(0, 20, 1, 1, (uint8_t *)msg, OLEDC_COLOR_DARKRED);
+    // oledC_DrawString(0, 20, 1, 1, (uint8_t *)msg, OLEDC_COLOR_DARKRED, NULL);
     // printf("Error: %s\n", msg);
     // for (;;)
     //     ;
 }
 
-int16_t readAxis(uint8_t regAddress)
+// All six data registers in one burst, so X, Y and Z come from the same
+// sample (the ADXL345 holds them while a multi-byte read is in progress).
+bool readAccel(ACCEL_DATA_t *accel)
 {
-    uint8_t lowByte, highByte;
+    uint8_t raw[6];
     int retries = 3;
     for (int i = 0; i < retries; i++)
     {
-        if (i2cReadSlaveRegister(WRITE_ADDRESS, regAddress, &lowByte) == OK)
-            break;
-        if (i == retries - 1)
-            errorStop("I2C Read Error (LSB)");
+        if (i2cReadSlaveRegisters(WRITE_ADDRESS, REG_DATAX0, raw, sizeof(raw)) == OK)
+        {
+            accel->x = ((int16_t)raw[1] << 8) | raw[0];
+            accel->y = ((int16_t)raw[3] << 8) | raw[2];
+            accel->z = ((int16_t)raw[5] << 8) | raw[4];
+            return true;
+        }
         DELAY_milliseconds(10);
     }
-    for (int i = 0; i < retries; i++)
+    errorStop("I2C Read Error");
+    return false;
+}
+
+static void writeAccelRegister(uint8_t reg, uint8_t value, char *error)
+{
+    for (int i = 0; i < 3; i++)
     {
-        if (i2cReadSlaveRegister(WRITE_ADDRESS, regAddress + 1, &highByte) == OK)
-            break;
-        if (i == retries - 1)
-            errorStop("I2C Read Error (MSB)");
+        if (i2cWriteSlave(WRITE_ADDRESS, reg, value) == OK)
+            return;
         DELAY_milliseconds(10);
     }
-    return ((int16_t)highByte << 8) | lowByte;
+    errorStop(error);
+}
+
+// Bandwidth follows the rate (ODR / 2). Low power mode trades some noise
+// for current and exists from 12.5 Hz up. The FIFO watermark moves with
+// the rate so INT1 keeps firing about every 0.8 s. Whatever the FIFO
+// holds was sampled at the old rate, so it goes: bypass mode empties it.
+bool setAccelRate(ACCEL_RATE_t rate, bool lowPower)
+{
+    if (rate >= ACCEL_RATE_COUNT || (lowPower && accelRates[rate].lowPowerMicroamps == 0))
+        return false;
+    writeAccelRegister(REG_FIFO_CTL, FIFO_BYPASS, "Accel FIFO Error");
+    writeAccelRegister(REG_BW_RATE, accelRates[rate].code | (lowPower ? LOW_POWER : 0), "Accel Rate Error");
+    writeAccelRegister(REG_FIFO_CTL, FIFO_STREAM | accelRates[rate].watermark, "Accel FIFO Error");
+    accelRate = rate;
+    accelLowPower = lowPower;
+    return true;
 }
 
+// Estimates for the current rate and state. Every second costs an
+// INT_SOURCE read (4 bytes); while active the FIFO drain adds a
+// FIFO_STATUS read plus a six-byte burst (9 bytes) per sample.
+void getAccelLoad(ACCEL_LOAD_t *load)
+{
+    const ACCEL_RATE_INFO_t *info = &accelRates[accelRate];
+    uint16_t bytes = 4;
+
+    if (movementDetected)
+        bytes += 4 + (uint16_t)((info->centiHz * 9UL + 99) / 100);
+
+    load->rate = accelRate;
+    load->lowPower = accelLowPower;
+    load->centiHz = info->centiHz;
+    load->bandwidthCentiHz = info->centiHz / 2;
+    load->sensorMicroamps = accelLowPower ? info->lowPowerMicroamps : info->normalMicroamps;
+    load->busBytesPerSecond = bytes;
+    // 9 bit times per byte, 100 bit times a millisecond
+    load->busPermille = (uint8_t)((bytes * 9UL + 99) / 100);
+}
+
+// The sensor samples into its FIFO in stream mode and raises INT1 once
+// enough samples are waiting, when something starts moving (activity)
+// and after INACT_SECONDS without movement (inactivity). The two are
+// linked, so they alternate and each activity is measured against the
+// orientation the watch came to rest in. Taps go to INT2 and are only
+// enabled while a page takes them. It starts idle, waiting for
+// activity. Everything is set up before measuring starts.
 void initAccelerometer(void)
 {
     I2Cerror err;
@@ -293,40 +426,31 @@ void initAccelerometer(void)
             errorStop("I2C Error or Wrong Device ID");
         DELAY_milliseconds(10);
     }
-    for (int i = 0; i < 3; i++)
-    {
-        err = i2cWriteSlave(WRITE_ADDRESS, REG_POWER_CTL, MEASURE_MODE);
-        if (err == OK)
-            break;
-        if (i == 2)
-            errorStop("Accel Power Error");
-        DELAY_milliseconds(10);
-    }
-    for (int i = 0; i < 3; i++)
-    {
-        err = i2cWriteSlave(WRITE_ADDRESS, 0x31, 0x0B);
-        if (err == OK)
-            break;
-        if (i == 2)
-            errorStop("Accel Data Format Error");
-        DELAY_milliseconds(10);
-    }
+    writeAccelRegister(REG_DATA_FORMAT, FULL_RES_16G, "Accel Data Format Error");
+    setAccelRate(ACCEL_RATE_12HZ5, true);
+    writeAccelRegister(REG_THRESH_ACT, ACT_THRESHOLD, "Accel Activity Error");
+    writeAccelRegister(REG_THRESH_INACT, INACT_THRESHOLD, "Accel Inactivity Error");
+    writeAccelRegister(REG_TIME_INACT, INACT_SECONDS, "Accel Inactivity Error");
+    writeAccelRegister(REG_ACT_INACT_CTL, ACT_INACT_AC_XYZ, "Accel Activity Error");
+    writeAccelRegister(REG_THRESH_TAP, TAP_THRESHOLD, "Accel Tap Error");
+    writeAccelRegister(REG_DUR, TAP_DURATION, "Accel Tap Error");
+    writeAccelRegister(REG_LATENT, TAP_LATENCY, "Accel Tap Error");
+    writeAccelRegister(REG_WINDOW, TAP_WINDOW, "Accel Tap Error");
+    writeAccelRegister(REG_TAP_AXES, TAP_AXES_XYZ, "Accel Tap Error");
+    writeAccelRegister(REG_INT_MAP, INT_SINGLE_TAP | INT_DOUBLE_TAP, "Accel Int Map Error");
+    writeAccelRegister(REG_INT_ENABLE, INT_WATERMARK | INT_ACTIVITY | INT_INACTIVITY, "Accel Int Enable Error");
+    writeAccelRegister(REG_POWER_CTL, LINK_ACT_INACT | MEASURE_MODE, "Accel Power Error");
 }
 
-void detectStep(void)
+// One sample of the step detector
+static void stepSample(const ACCEL_DATA_t *accel)
 {
-    ACCEL_DATA_t accel;
-    accel.x = readAxis(REG_DATAX0);
-    accel.y = readAxis(REG_DATAY0);
-    accel.z = readAxis(REG_DATAZ0);
-
-    float ax = accel.x * 4.0f;
-    float ay = accel.y * 4.0f;
-    float az = accel.z * 4.0f;
+    float ax = accel->x * 4.0f;
+    float ay = accel->y * 4.0f;
+    float az = accel->z * 4.0f;
     float mag = sqrtf(ax * ax + ay * ay + az * az);
     float dynamic = fabsf(mag - baselineGravity);
     bool above = (dynamic > STEP_THRESHOLD);
-    movementDetected = above;
 
     if (above && !wasAboveThreshold)
     {
@@ -337,6 +461,128 @@ void detectStep(void)
     wasAboveThreshold = above;
 }
 
+// Runs the detector over everything in the FIFO once the watermark is
+// reached. At up to 25 Hz the FIFO holds more than a second, so one
+// drain a second loses nothing. Each entry still needs its own six-byte
+// read, as the ADXL345 pops an entry only once its data registers have
+// been read.
+void detectStep(void)
+{
+    ACCEL_DATA_t accel;
+    uint8_t status, entries;
+
+    if (i2cReadSlaveRegister(WRITE_ADDRESS, REG_FIFO_STATUS, &status) != OK)
+        return;
+    entries = status & 0x3F;
+    if (entries < accelRates[accelRate].watermark)
+        return;
+    if (entries > FIFO_DEPTH)
+        entries = FIFO_DEPTH;
+    while (entries-- > 0)
+    {
+        if (!readAccel(&accel))
+            return;
+        stepSample(&accel);
+    }
+}
+
+static void readAccelEvents(void)
+{
+    uint8_t source;
+
+    if (i2cReadSlaveRegister(WRITE_ADDRESS, REG_INT_SOURCE, &source) == OK)
+        accelEvents |= source;
+}
+
+// INT1 is not routed to an MCU pin here, so the Timer1 tick stands in
+// for it: one INT_SOURCE read a second. The step pipeline only runs
+// between an activity and an inactivity event, at full rate; the rest of
+// the time the sensor idles at 12.5 Hz in low power mode and the FIFO is
+// not read.
+void serviceAccel(void)
+{
+    uint8_t source;
+
+    readAccelEvents();
+    source = accelEvents;
+    accelEvents &= ~(INT_ACTIVITY | INT_INACTIVITY | INT_WATERMARK);
+    // Linked events alternate, so both in one read are two changes
+    for (int i = 0; i < 2; i++)
+    {
+        if (movementDetected && (source & INT_INACTIVITY))
+        {
+            source &= ~INT_INACTIVITY;
+            movementDetected = false;
+            wasAboveThreshold = false;
+            setAccelRate(ACCEL_RATE_12HZ5, true);
+        }
+        else if (!movementDetected && (source & INT_ACTIVITY))
+        {
+            source &= ~INT_ACTIVITY;
+            movementDetected = true;
+            inactivityCounter = 0;
+            setAccelRate(ACCEL_RATE_25HZ, true);
+        }
+    }
+    if (movementDetected && (source & INT_WATERMARK))
+        detectStep();
+}
+
+// Taps are only a few samples long, so pages that take them run the
+// sensor at 100 Hz and hand the pedometer its rate back when they close.
+// Nothing drains the FIFO while a page is open, so it stays in bypass
+// mode rather than overflowing with 100 Hz samples; closing the page
+// restarts stream mode empty. Whatever tapped before the page opened is
+// dropped.
+static void setTapInput(bool on)
+{
+    uint8_t enable = INT_WATERMARK | INT_ACTIVITY | INT_INACTIVITY;
+
+    if (on)
+    {
+        enable |= INT_SINGLE_TAP | INT_DOUBLE_TAP;
+        writeAccelRegister(REG_FIFO_CTL, FIFO_BYPASS, "Accel FIFO Error");
+        writeAccelRegister(REG_BW_RATE, TAP_RATE_100HZ | LOW_POWER, "Accel Rate Error");
+    }
+    else
+    {
+        setAccelRate(accelRate, accelLowPower);
+    }
+    writeAccelRegister(REG_INT_ENABLE, enable, "Accel Int Enable Error");
+    if (on)
+        readAccelEvents();
+    accelEvents &= ~(INT_SINGLE_TAP | INT_DOUBLE_TAP);
+    tapPasses = 0;
+    tapSingleWait = 0;
+}
+
+// Called once per 50 ms page pass. INT2 is not routed to an MCU pin
+// either, so INT_SOURCE is read every TAP_POLL_PASSES passes. The first
+// tap of a double tap also raises SINGLE_TAP, so a single tap only
+// counts once TAP_DECIDE_POLLS more reads (400 ms) have passed without a
+// double tap, by when LATENT and WINDOW (350 ms) have run out.
+TAP_EVENT_t takeTapEvent(void)
+{
+    if (++tapPasses < TAP_POLL_PASSES)
+        return TAP_NONE;
+    tapPasses = 0;
+    readAccelEvents();
+    if (accelEvents & INT_DOUBLE_TAP)
+    {
+        accelEvents &= ~(INT_SINGLE_TAP | INT_DOUBLE_TAP);
+        tapSingleWait = 0;
+        return TAP_DOUBLE;
+    }
+    if (tapSingleWait > 0)
+        return --tapSingleWait == 0 ? TAP_SINGLE : TAP_NONE;
+    if (accelEvents & INT_SINGLE_TAP)
+    {
+        accelEvents &= ~INT_SINGLE_TAP;
+        tapSingleWait = TAP_DECIDE_POLLS;
+    }
+    return TAP_NONE;
+}
+
 void drawSteps(void)
 {
     uint16_t sum = 0;
@@ -382,18 +628,21 @@ void drawSteps(void)
     char newStr[6];
     if (pace == 0)
     {
-        if (oldStr[0] != '\0')
-        {
-            oledC_DrawString(80, 2, 1, 1, (uint8_t *)oldStr, OLEDC_COLOR_BLACK);
-            oldStr[0] = '\0';
-        }
-        return;
+        newStr[0] = '\0';
+    }
+    else
+    {
+        sprintf(newStr, "%u", pace);
     }
-    sprintf(newStr, "%u", pace);
     if (strcmp(oldStr, newStr) != 0)
     {
-        oledC_DrawString(80, 2, 1, 1, (uint8_t *)oldStr, OLEDC_COLOR_BLACK);
-        oledC_DrawString(80, 2, 1, 1, (uint8_t *)newStr, OLEDC_COLOR_WHITE);
+        // The pace box is a viewport: local coordinates, and a long
+        // number is cut at its edge instead of running off the panel.
+        // The shadow only sends the pixels that differ from the old value.
+        oledC_pushViewport(80, 2, 16, 9);
+        oledC_DrawRectangle(0, 0, 15, 8, OLEDC_COLOR_BLACK);
+        oledC_DrawString(0, 0, 1, 1, (uint8_t *)newStr, OLEDC_COLOR_WHITE, NULL);
+        oledC_popClip();
         strcpy(oldStr, newStr);
     }
 }
@@ -438,27 +687,60 @@ void incrementTime(ClockTime *t)
     }
 }
 
+// ---------------- Watch face slots ----------------
+// HH:MM:SS in the large numeral font, one slot per character; AM/PM and
+// the date are small-font slots. Each slot only repaints when it changes.
+#define CLOCK_SLOTS 8
+#define DATE_SLOTS 5
+static oledc_text_slot_t clockSlots[CLOCK_SLOTS];
+static oledc_text_slot_t dateSlots[DATE_SLOTS];
+static oledc_text_slot_t amPmSlots[2];
+static bool slotsReady = false;
+
+static void initClockSlots(void)
+{
+    uint8_t x = 2;
+    for (uint8_t i = 0; i < CLOCK_SLOTS; i++)
+    {
+        // Digits are 12 columns wide, the colons (slots 2 and 5) 3, all 2 apart.
+        uint8_t width = (i == 2 || i == 5) ? 3 : 12;
+        oledC_slotInit(&clockSlots[i], x, 42, width, &oledC_fontLarge, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
+        x += width + 2;
+    }
+    // Same cells as the old 1x text: 5 columns every 6 pixels
+    for (uint8_t i = 0; i < DATE_SLOTS; i++)
+        oledC_slotInit(&dateSlots[i], 65 + i * 6, 86, 5, &oledC_fontSmall, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
+    for (uint8_t i = 0; i < 2; i++)
+        oledC_slotInit(&amPmSlots[i], i * 6, 86, 5, &oledC_fontSmall, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
+    slotsReady = true;
+}
+
+static void updateTwoDigitSlots(oledc_text_slot_t *slots, uint8_t value)
+{
+    oledC_slotUpdate(&slots[0], '0' + value / 10);
+    oledC_slotUpdate(&slots[1], '0' + value % 10);
+}
+
 void drawClock(ClockTime *time)
 {
-    static char oldTime[9] = "";
-    static char oldDate[6] = "";
-    static bool oldWas12H = false;
-    static bool oldPM = false;
+    static bool amPmShown = false;
 
+    if (!slotsReady)
+        initClockSlots();
     if (forceClockRedraw)
     {
-        oldTime[0] = '\0';
-        oldDate[0] = '\0';
-        oldWas12H = !is12HourFormat;
-        oldPM = false;
+        // The screen was cleared: every slot has to be painted again.
+        for (uint8_t i = 0; i < CLOCK_SLOTS; i++)
+            oledC_slotInvalidate(&clockSlots[i]);
+        for (uint8_t i = 0; i < DATE_SLOTS; i++)
+            oledC_slotInvalidate(&dateSlots[i]);
+        oledC_slotInvalidate(&amPmSlots[0]);
+        oledC_slotInvalidate(&amPmSlots[1]);
+        amPmShown = true;
         forceClockRedraw = false;
     }
 
-    char newTime[9];
-    char buff[3];
-    char newDateStr[6];
     bool pm = false;
-
     uint8_t displayHrs = time->hours;
     if (is12HourFormat)
     {
@@ -474,52 +756,30 @@ void drawClock(ClockTime *time)
         }
     }
 
-    twoDigitString(displayHrs, buff);
-    sprintf(newTime, "%s:", buff);
-    twoDigitString(time->minutes, buff);
-    strcat(newTime, buff);
-    strcat(newTime, ":");
-    twoDigitString(time->seconds, buff);
-    strcat(newTime, buff);
-
-    // If there is any change in time or format, clear old areas and redraw.
-    if (strcmp(oldTime, newTime) != 0 || oldWas12H != is12HourFormat || oldPM != pm)
-    {
-        oledC_DrawString(8, 45, 2, 2, (uint8_t *)oldTime, OLEDC_COLOR_BLACK);
-        oledC_DrawRectangle(50, 45, 80, 60, OLEDC_COLOR_BLACK);
-        oledC_DrawString(8, 45, 2, 2, (uint8_t *)newTime, OLEDC_COLOR_WHITE);
-        if (is12HourFormat)
-        {
-            if (pm)
-                oledC_DrawString(0, 85, 1, 1, (uint8_t *)"PM", OLEDC_COLOR_WHITE);
-            else
-                oledC_DrawString(0, 85, 1, 1, (uint8_t *)"AM", OLEDC_COLOR_WHITE);
-        }
+    // Usually only the seconds' ones digit differs from what is shown.
+    updateTwoDigitSlots(&clockSlots[0], displayHrs);
+    oledC_slotUpdate(&clockSlots[2], ':');
+    updateTwoDigitSlots(&clockSlots[3], time->minutes);
+    oledC_slotUpdate(&clockSlots[5], ':');
+    updateTwoDigitSlots(&clockSlots[6], time->seconds);
 
-        strcpy(oldTime, newTime);
-        oldWas12H = is12HourFormat;
-        oldPM = pm;
+    if (is12HourFormat)
+    {
+        oledC_slotUpdate(&amPmSlots[0], pm ? 'P' : 'A');
+        oledC_slotUpdate(&amPmSlots[1], 'M');
+        amPmShown = true;
     }
-
-    twoDigitString(time->day, buff);
-    sprintf(newDateStr, "%s/", buff);
-    twoDigitString(time->month, buff);
-    strcat(newDateStr, buff);
-
-    if (strcmp(oldDate, newDateStr) != 0)
+    else if (amPmShown)
     {
-        oledC_DrawString(65, 85, 1, 1, (uint8_t *)oldDate, OLEDC_COLOR_BLACK);
-        oledC_DrawString(65, 85, 1, 1, (uint8_t *)newDateStr, OLEDC_COLOR_WHITE);
-        strcpy(oldDate, newDateStr);
+        oledC_DrawRectangle(0, 85, 11, 93, OLEDC_COLOR_BLACK);
+        oledC_slotInvalidate(&amPmSlots[0]);
+        oledC_slotInvalidate(&amPmSlots[1]);
+        amPmShown = false;
     }
-}
 
-void drawFootIcon(uint8_t x, uint8_t y, const uint16_t *bitmap, uint8_t width, uint8_t height)
-{
-    for (uint8_t row = 0; row < height; row++)
-        for (uint8_t col = 0; col < width; col++)
-            if (bitmap[row] & (1 << (width - 1 - col)))
-                oledC_DrawPoint(x + col, y + row, OLEDC_COLOR_WHITE);
+    updateTwoDigitSlots(&dateSlots[0], time->day);
+    oledC_slotUpdate(&dateSlots[2], '/');
+    updateTwoDigitSlots(&dateSlots[3], time->month);
 }
 
 // ---------------- 12H/24H SYSTEM ---------------- //
@@ -563,30 +823,32 @@ void handleTimeFormatSelection(void)
 void drawTimeFormatSubpage(void)
 {
     oledC_clearScreen();
+    oledC_listBegin();
     // Display a title (optional)
-    oledC_DrawString(10, 5, 1, 1, (uint8_t *)"Choose Format:", OLEDC_COLOR_WHITE);
+    oledC_DrawString(10, 5, 1, 1, (uint8_t *)"Choose Format:", OLEDC_COLOR_WHITE, NULL);
 
     // Draw "12H" item at y=25.
     if (timeFormatSelectedIndex == 0)
     {
         oledC_DrawRectangle(8, 23, 60, 35, OLEDC_COLOR_WHITE);
-        oledC_DrawString(10, 25, 1, 1, (uint8_t *)"12H", OLEDC_COLOR_BLACK);
+        oledC_DrawString(10, 25, 1, 1, (uint8_t *)"12H", OLEDC_COLOR_BLACK, NULL);
     }
     else
     {
-        oledC_DrawString(10, 25, 1, 1, (uint8_t *)"12H", OLEDC_COLOR_WHITE);
+        oledC_DrawString(10, 25, 1, 1, (uint8_t *)"12H", OLEDC_COLOR_WHITE, NULL);
     }
 
     // Draw "24H" item at y=40.
     if (timeFormatSelectedIndex == 1)
     {
         oledC_DrawRectangle(8, 38, 60, 50, OLEDC_COLOR_WHITE);
-        oledC_DrawString(10, 40, 1, 1, (uint8_t *)"24H", OLEDC_COLOR_BLACK);
+        oledC_DrawString(10, 40, 1, 1, (uint8_t *)"24H", OLEDC_COLOR_BLACK, NULL);
     }
     else
     {
-        oledC_DrawString(10, 40, 1, 1, (uint8_t *)"24H", OLEDC_COLOR_WHITE);
+        oledC_DrawString(10, 40, 1, 1, (uint8_t *)"24H", OLEDC_COLOR_WHITE, NULL);
     }
+    oledC_listEnd();
 }
 
 // ---------------- SET TIME SYSTEM ---------------- //
@@ -594,11 +856,14 @@ void drawSetTimeMenuBase(void)
 {
     oledC_clearScreen();
 
+    // The static part is recorded and sent as one optimised display list.
+    oledC_listBegin();
+
     // Clear any mini clock area.
     oledC_DrawRectangle(30, 2, 115, 10, OLEDC_COLOR_BLACK);
 
     // Display header.
-    oledC_DrawString(6, 10, 2, 2, (uint8_t *)"Set Time", OLEDC_COLOR_WHITE);
+    oledC_DrawString(6, 10, 2, 2, (uint8_t *)"Set Time", OLEDC_COLOR_WHITE, NULL);
 
     if (timeSelection == 0)
     {
@@ -619,6 +884,7 @@ void drawSetTimeMenuBase(void)
         oledC_DrawRectangle(50, 40, 86, 64, OLEDC_COLOR_WHITE);
         oledC_DrawRectangle(52, 42, 84, 62, OLEDC_COLOR_BLACK);
     }
+    oledC_listEnd();
 
     drawSetTimeStatus();
 }
@@ -628,15 +894,12 @@ void drawSetTimeStatus(void)
 {
     char buf[3];
 
-    // Clear the region where the hour value is drawn.
-    oledC_DrawRectangle(15, 46, 43, 62, OLEDC_COLOR_BLACK);
+    // Opaque text replaces the old value without clearing it first.
     sprintf(buf, "%02d", setClock.hours);
-    oledC_DrawString(15, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE);
+    oledC_DrawStringOpaque(15, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
 
-    // Clear the region where the minute value is drawn.
-    oledC_DrawRectangle(55, 46, 83, 62, OLEDC_COLOR_BLACK);
     sprintf(buf, "%02d", setClock.minutes);
-    oledC_DrawString(55, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE);
+    oledC_DrawStringOpaque(55, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
 }
 
 // Handle input for the Set Time page using RA11 (S1) and RA12 (S2).
@@ -678,26 +941,6 @@ void handleSetTimeInput(void)
     s1WasPressed = s1State;
     s2WasPressed = s2State;
 }
-bool detectTiltForSave(void)
-{
-    ACCEL_DATA_t accel;
-    accel.x = readAxis(REG_DATAX0);
-    accel.y = readAxis(REG_DATAY0);
-    accel.z = readAxis(REG_DATAZ0);
-
-    // Adjust the threshold as needed for your device sensitivity.
-    const float tiltThreshold = 700.0f;
-
-    // Convert raw values to a magnitude.
-    float ax = accel.x * 4.0f;
-    float ay = accel.y * 4.0f;
-    float az = accel.z * 4.0f;
-    float magnitude = sqrtf(ax * ax + ay * ay + az * az);
-
-    // If the magnitude is below the threshold, we consider that a tilt save gesture.
-    return (magnitude < tiltThreshold);
-}
-
 void handleSetTimePage(void)
 {
     inTimeSetSubpage = true; // Enter Set Time page.
@@ -715,33 +958,28 @@ void handleSetTimePage(void)
         DELAY_milliseconds(10);
     }
 
-    int tiltCounter = 0; // Debounce counter for the tilt
-    // Poll for tilt while handling input.
+    // Double tap saves, a single tap leaves without saving.
+    setTapInput(true);
     while (inTimeSetSubpage)
     {
         handleSetTimeInput();
 
-        if (detectTiltForSave())
+        TAP_EVENT_t tap = takeTapEvent();
+        if (tap == TAP_DOUBLE)
         {
-            tiltCounter++;
-            // Save if tilt is detected for one iteration (~50ms)
-            if (tiltCounter >= 1)
-            {
-                currentTime.hours = setClock.hours;
-                currentTime.minutes = setClock.minutes;
-                currentTime.seconds = 0; // Reset seconds to 00
-
-                inTimeSetSubpage = false;
-                break;
-            }
+            currentTime.hours = setClock.hours;
+            currentTime.minutes = setClock.minutes;
+            currentTime.seconds = 0; // Reset seconds to 00
         }
-        else
+        if (tap != TAP_NONE)
         {
-            tiltCounter = 0; // Reset if no tilt is detected.
+            inTimeSetSubpage = false;
+            break;
         }
 
         DELAY_milliseconds(50); // Reduced delay for quicker response
     }
+    setTapInput(false);
 }
 
 // ---------------- SET DATE SYSTEM ---------------- //
@@ -749,11 +987,14 @@ void drawSetDateMenuBase(void)
 {
     oledC_clearScreen();
 
+    // The static part is recorded and sent as one optimised display list.
+    oledC_listBegin();
+
     // Clear any mini clock area.
     oledC_DrawRectangle(30, 2, 115, 10, OLEDC_COLOR_BLACK);
 
     // Display header.
-    oledC_DrawString(6, 10, 2, 2, (uint8_t *)"Set Date", OLEDC_COLOR_WHITE);
+    oledC_DrawString(6, 10, 2, 2, (uint8_t *)"Set Date", OLEDC_COLOR_WHITE, NULL);
 
     if (dateSelection == 0)
     {
@@ -774,6 +1015,7 @@ void drawSetDateMenuBase(void)
         oledC_DrawRectangle(50, 40, 86, 64, OLEDC_COLOR_WHITE);
         oledC_DrawRectangle(52, 42, 84, 62, OLEDC_COLOR_BLACK);
     }
+    oledC_listEnd();
 
     drawSetDateStatus();
 }
@@ -782,15 +1024,12 @@ void drawSetDateStatus(void)
 {
     char buf[3];
 
-    // Clear and draw the day value.
-    oledC_DrawRectangle(15, 46, 43, 62, OLEDC_COLOR_BLACK);
+    // Draw the day and month values as opaque text.
     sprintf(buf, "%02d", setDate.day);
-    oledC_DrawString(15, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE);
+    oledC_DrawStringOpaque(15, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
 
-    // Clear and draw the month value.
-    oledC_DrawRectangle(55, 46, 83, 62, OLEDC_COLOR_BLACK);
     sprintf(buf, "%02d", setDate.month);
-    oledC_DrawString(55, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE);
+    oledC_DrawStringOpaque(55, 46, 2, 2, (uint8_t *)buf, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
 }
 
 void handleSetDateInput(void)
@@ -869,31 +1108,28 @@ void handleSetDatePage(void)
         DELAY_milliseconds(10);
     }
 
-    int tiltCounter = 0; // Debounce counter.
+    // Double tap saves, a single tap leaves without saving.
+    setTapInput(true);
     while (inTimeSetSubpage)
     {
         handleSetDateInput();
 
-        if (detectTiltForSave())
+        TAP_EVENT_t tap = takeTapEvent();
+        if (tap == TAP_DOUBLE)
         {
-            tiltCounter++;
-            // Save if a tilt is detected (using your chosen sensitivity).
-            if (tiltCounter >= 1)
-            {
-                currentTime.day = setDate.day;
-                currentTime.month = setDate.month;
-                // Exit the set date page.
-                inTimeSetSubpage = false;
-                break;
-            }
+            currentTime.day = setDate.day;
+            currentTime.month = setDate.month;
         }
-        else
+        if (tap != TAP_NONE)
         {
-            tiltCounter = 0;
+            // Exit the set date page.
+            inTimeSetSubpage = false;
+            break;
         }
 
         DELAY_milliseconds(50);
     }
+    setTapInput(false);
 }
 
 // ---------------- MENU SYSTEM (Integrated in main.c) ----------------
@@ -908,38 +1144,17 @@ const char *menuItems[MENU_ITEMS_COUNT] = {
 // bool inMenu = false;
 uint8_t selectedMenuItem = 0;
 
-void drawMenu(void)
-{
-    // Clear the screen to black.
-    oledC_clearScreen();
-
-    // Draw the mini clock at the top right.
-    updateMenuClock();
+// Menu page as a shape list, so it can be rendered in one burst
+static char menuClockText[9];
+static bool menuClockPM = false;
+static shape_t menuShapes[2 + 2 * MENU_ITEMS_COUNT];
+static const oledc_rect_t menuClockArea = {30, 2, 95, 10};
 
-    // Draw menu items (no "MENU" label)
-    for (uint8_t i = 0; i < MENU_ITEMS_COUNT; i++)
-    {
-        uint8_t yPos = 20 + (i * 12);
-        if (i == selectedMenuItem)
-        {
-            // Draw a white highlight rectangle for the selected item.
-            oledC_DrawRectangle(3, yPos - 2, 115, yPos + 10, OLEDC_COLOR_WHITE);
-            // Draw black text inside the blue rectangle.
-            oledC_DrawString(4, yPos, 1, 1, (uint8_t *)menuItems[i], OLEDC_COLOR_BLACK);
-        }
-        else
-        {
-            // Draw unselected items as white text on black.
-            oledC_DrawString(4, yPos, 1, 1, (uint8_t *)menuItems[i], OLEDC_COLOR_WHITE);
-        }
-    }
-}
-
-void updateMenuClock(void)
+// Returns true when the mini clock text changed; area gets the columns that differ
+static bool formatMenuClock(oledc_rect_t *area)
 {
     char timeStr[9], buff[3];
     // If 12H, subtract 12 if hours >= 12, etc.
-    // Then append AM/PM if is12HourFormat is true.
 
     uint8_t displayHrs = currentTime.hours;
     bool pm = false;
@@ -966,18 +1181,85 @@ void updateMenuClock(void)
     twoDigitString(currentTime.seconds, buff);
     strcat(timeStr, buff);
 
-    // Clear old clock
-    oledC_DrawRectangle(30, 2, 115, 10, OLEDC_COLOR_BLACK);
-    // Draw time
-    oledC_DrawString(30, 2, 1, 1, (uint8_t *)timeStr, OLEDC_COLOR_WHITE);
+    if (strcmp(timeStr, menuClockText) == 0 && pm == menuClockPM)
+        return false;
+    *area = menuClockArea;
+    if (pm == menuClockPM && strlen(menuClockText) == strlen(timeStr))
+    {
+        uint8_t first = 0, last = strlen(timeStr) - 1;
+        while (timeStr[first] == menuClockText[first])
+            first++;
+        while (timeStr[last] == menuClockText[last])
+            last--;
+        area->xs = menuClockArea.xs + first * 6;
+        area->xe = menuClockArea.xs + last * 6 + 4;
+    }
+    strcpy(menuClockText, timeStr);
+    menuClockPM = pm;
+    return true;
+}
 
-    // If 12H, append AM/PM
+static uint8_t buildMenuShapes(void)
+{
+    shape_params_t params;
+    uint8_t n = 0;
+
+    // Mini clock at the top right, then AM/PM if 12H
+    params.string.color = OLEDC_COLOR_WHITE;
+    params.string.x = 30;
+    params.string.y = 2;
+    params.string.scale_x = 1;
+    params.string.scale_y = 1;
+    params.string.string = (uint8_t *)menuClockText;
+    params.string.font = NULL;
+    oledC_createShape(OLED_SHAPE_STRING, &params, &menuShapes[n++]);
     if (is12HourFormat)
     {
-        if (pm)
-            oledC_DrawString(80, 2, 1, 1, (uint8_t *)"PM", OLEDC_COLOR_WHITE);
-        else
-            oledC_DrawString(80, 2, 1, 1, (uint8_t *)"AM", OLEDC_COLOR_WHITE);
+        params.string.x = 80;
+        params.string.string = (uint8_t *)(menuClockPM ? "PM" : "AM");
+        oledC_createShape(OLED_SHAPE_STRING, &params, &menuShapes[n++]);
+    }
+
+    // Menu items (no "MENU" label)
+    for (uint8_t i = 0; i < MENU_ITEMS_COUNT; i++)
+    {
+        uint8_t yPos = 20 + (i * 12);
+        if (i == selectedMenuItem)
+        {
+            // White highlight rectangle with black text for the selected item.
+            params.rectangle.color = OLEDC_COLOR_WHITE;
+            params.rectangle.xs = 3;
+            params.rectangle.ys = yPos - 2;
+            params.rectangle.xe = 115;
+            params.rectangle.ye = yPos + 10;
+            oledC_createShape(OLED_SHAPE_RECTANGLE, &params, &menuShapes[n++]);
+        }
+        params.string.color = (i == selectedMenuItem) ? OLEDC_COLOR_BLACK : OLEDC_COLOR_WHITE;
+        params.string.x = 4;
+        params.string.y = yPos;
+        params.string.scale_x = 1;
+        params.string.scale_y = 1;
+        params.string.string = (uint8_t *)menuItems[i];
+        oledC_createShape(OLED_SHAPE_STRING, &params, &menuShapes[n++]);
+    }
+    return n;
+}
+
+void drawMenu(void)
+{
+    // Background and every item go out in a single full-screen burst.
+    oledc_rect_t changed;
+    formatMenuClock(&changed);
+    oledC_scanlineRender(NULL, menuShapes, buildMenuShapes(), OLEDC_COLOR_BLACK);
+}
+
+void updateMenuClock(void)
+{
+    // Only the clock digits that changed are re-rendered.
+    oledc_rect_t changed;
+    if (formatMenuClock(&changed))
+    {
+        oledC_scanlineRender(&changed, menuShapes, buildMenuShapes(), OLEDC_COLOR_BLACK);
     }
 }
 
@@ -1007,6 +1289,8 @@ void executeMenuAction(void)
         forceClockRedraw = true;
         oledC_DrawRectangle(40, 2, 115, 10, OLEDC_COLOR_BLACK);
         oledC_clearScreen();
+        oledC_shadowReset(OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
+        oledC_spriteInvalidate(&footSprite);
         break;
 
     default:
@@ -1052,8 +1336,11 @@ void User_Initialize(void)
 }
 
 // ---------------- TIMER1 INTERRUPT (Integrated Menu Handling) ----------------
-// Global or file-scope variable to indicate we just entered the menu
-static bool justEnteredMenu = false;
+// Global or file-scope variable to indicate we just entered the menu.
+// The main loop draws the menu when it sees it: drawMenu() shares the
+// scanline renderer with the rest of the display code, so it must not run
+// from the interrupt.
+static volatile bool justEnteredMenu = false;
 
 void __attribute__((__interrupt__, auto_psv)) _T1Interrupt(void)
 {
@@ -1072,7 +1359,6 @@ void __attribute__((__interrupt__, auto_psv)) _T1Interrupt(void)
         {
             inMenu = true;
             selectedMenuItem = 0;
-            drawMenu();
             justEnteredMenu = true; // <--- set this flag
             s1HoldCounter = 0;
         }
@@ -1086,14 +1372,17 @@ void __attribute__((__interrupt__, auto_psv)) _T1Interrupt(void)
     if (!inMenu)
     {
         if (!movementDetected)
-            inactivityCounter++;
+        {
+            if (inactivityCounter < 255)
+                inactivityCounter++;
+        }
         else
             inactivityCounter = 0;
 
         currentSecondIndex = (currentSecondIndex + 1) % HISTORY_SIZE;
         stepsHistory[currentSecondIndex] = 0;
 
-        detectStep();
+        accelDue = true;
         updateStepHistory();
     }
 
@@ -1110,6 +1399,8 @@ int main(void)
     User_Initialize();
     oledC_setBackground(OLEDC_COLOR_BLACK);
     oledC_clearScreen();
+    oledC_shadowReset(OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
+    oledC_spriteInit(&footSprite, footFrames, 2, footDeltas, 1, OLEDC_COLOR_WHITE, OLEDC_COLOR_BLACK);
     i2c1_open();
 
     // Detect the accelerometer
@@ -1137,8 +1428,9 @@ int main(void)
 
             if (justEnteredMenu)
             {
-                // When first entering the menu, wait for the user to release the buttons.
+                // When first entering the menu, draw it and wait for the user to release the buttons.
                 justEnteredMenu = false;
+                drawMenu();
                 bool s1State = (PORTAbits.RA11 == 0);
                 bool s2State = (PORTAbits.RA12 == 0);
                 s1WasPressed = s1State;
@@ -1191,12 +1483,19 @@ int main(void)
             }
 
             // Run the normal pedometer/clock functions.
-            detectStep();
+            if (accelDue)
+            {
+                accelDue = false;
+                serviceAccel();
+            }
+            oledC_shadowBegin();
             drawSteps();
             drawClock(&currentTime);
-            oledC_DrawRectangle(0, 0, 15, 15, OLEDC_COLOR_BLACK);
             if (displayedPace > 0)
-                drawFootIcon(0, 0, footToggle ? foot1Bitmap : foot2Bitmap, 16, 16);
+                oledC_spriteShow(&footSprite, 0, 0, footToggle ? 0 : 1);
+            else
+                oledC_spriteHide(&footSprite);
+            oledC_shadowEnd();
         }
 
         DELAY_milliseconds(100);
@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c i2cDriver/i2c1_driver.c Accel_i2c.c
+SOURCEFILES_QUOTED_IF_SPACED=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/oledC_shadow.c oledDriver/oledC_displayList.c oledDriver/oledC_sprite.c oledDriver/oledC_scanline.c oledDriver/oledC_fonts.c oledDriver/oledC_image.c oledDriver/oledC_fontData.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c i2cDriver/i2c1_driver.c Accel_i2c.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver/i2c1_driver.o ${OBJECTDIR}/Accel_i2c.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/oledDriver/oledC.o.d ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d ${OBJECTDIR}/oledDriver/oledC_shapes.o.d ${OBJECTDIR}/oledDriver/pin_manager.o.d ${OBJECTDIR}/spiDriver/spi1_driver.o.d ${OBJECTDIR}/System/clock.o.d ${OBJECTDIR}/System/delay.o.d ${OBJECTDIR}/System/system.o.d ${OBJECTDIR}/System/traps.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/i2cDriver/i2c1_driver.o.d ${OBJECTDIR}/Accel_i2c.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/oledC_shadow.o ${OBJECTDIR}/oledDriver/oledC_displayList.o ${OBJECTDIR}/oledDriver/oledC_sprite.o ${OBJECTDIR}/oledDriver/oledC_scanline.o ${OBJECTDIR}/oledDriver/oledC_fonts.o ${OBJECTDIR}/oledDriver/oledC_image.o ${OBJECTDIR}/oledDriver/oledC_fontData.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver/i2c1_driver.o ${OBJECTDIR}/Accel_i2c.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/oledDriver/oledC.o.d ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o.d ${OBJECTDIR}/oledDriver/oledC_shapes.o.d ${OBJECTDIR}/oledDriver/oledC_shadow.o.d ${OBJECTDIR}/oledDriver/oledC_displayList.o.d ${OBJECTDIR}/oledDriver/oledC_sprite.o.d ${OBJECTDIR}/oledDriver/oledC_scanline.o.d ${OBJECTDIR}/oledDriver/oledC_fonts.o.d ${OBJECTDIR}/oledDriver/oledC_image.o.d ${OBJECTDIR}/oledDriver/oledC_fontData.o.d ${OBJECTDIR}/oledDriver/pin_manager.o.d ${OBJECTDIR}/spiDriver/spi1_driver.o.d ${OBJECTDIR}/System/clock.o.d ${OBJECTDIR}/System/delay.o.d ${OBJECTDIR}/System/system.o.d ${OBJECTDIR}/System/traps.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/i2cDriver/i2c1_driver.o.d ${OBJECTDIR}/Accel_i2c.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver/i2c1_driver.o ${OBJECTDIR}/Accel_i2c.o
+OBJECTFILES=${OBJECTDIR}/oledDriver/oledC.o ${OBJECTDIR}/oledDriver/oledC_shapeHandler.o ${OBJECTDIR}/oledDriver/oledC_shapes.o ${OBJECTDIR}/oledDriver/oledC_shadow.o ${OBJECTDIR}/oledDriver/oledC_displayList.o ${OBJECTDIR}/oledDriver/oledC_sprite.o ${OBJECTDIR}/oledDriver/oledC_scanline.o ${OBJECTDIR}/oledDriver/oledC_fonts.o ${OBJECTDIR}/oledDriver/oledC_image.o ${OBJECTDIR}/oledDriver/oledC_fontData.o ${OBJECTDIR}/oledDriver/pin_manager.o ${OBJECTDIR}/spiDriver/spi1_driver.o ${OBJECTDIR}/System/clock.o ${OBJECTDIR}/System/delay.o ${OBJECTDIR}/System/system.o ${OBJECTDIR}/System/traps.o ${OBJECTDIR}/main.o ${OBJECTDIR}/i2cDriver/i2c1_driver.o ${OBJECTDIR}/Accel_i2c.o
 
 # Source Files
-SOURCEFILES=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c i2cDriver/i2c1_driver.c Accel_i2c.c
+SOURCEFILES=oledDriver/oledC.c oledDriver/oledC_shapeHandler.c oledDriver/oledC_shapes.c oledDriver/oledC_shadow.c oledDriver/oledC_displayList.c oledDriver/oledC_sprite.c oledDriver/oledC_scanline.c oledDriver/oledC_fonts.c oledDriver/oledC_image.c oledDriver/oledC_fontData.c oledDriver/pin_manager.c spiDriver/spi1_driver.c System/clock.c System/delay.c System/system.c System/traps.c main.c i2cDriver/i2c1_driver.c Accel_i2c.c
 
 
 
@@ -107,6 +107,48 @@ ${OBJECTDIR}/oledDriver/oledC_shapes.o: oledDriver/oledC_shapes.c  .generated_fi
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapes.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shapes.c  -o ${OBJECTDIR}/oledDriver/oledC_shapes.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shapes.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/oledDriver/oledC_shadow.o: oledDriver/oledC_shadow.c  .generated_files/flags/default/edb2331ab3cc920a2bb392381d6ee659a80af9b6 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_shadow.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_shadow.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shadow.c  -o ${OBJECTDIR}/oledDriver/oledC_shadow.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shadow.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_displayList.o: oledDriver/oledC_displayList.c  .generated_files/flags/default/4d5f7b39c238d5a50f561b84037eba6e43e46024 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_displayList.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_displayList.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_displayList.c  -o ${OBJECTDIR}/oledDriver/oledC_displayList.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_displayList.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_sprite.o: oledDriver/oledC_sprite.c  .generated_files/flags/default/afafcb800ea5cbab4b65e0aee3bfd434baca7951 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_sprite.c  -o ${OBJECTDIR}/oledDriver/oledC_sprite.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_sprite.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_scanline.o: oledDriver/oledC_scanline.c  .generated_files/flags/default/c69531b94a8efd8cda71e7bb44a0b488d3ea405c .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scanline.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scanline.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_scanline.c  -o ${OBJECTDIR}/oledDriver/oledC_scanline.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_scanline.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_fonts.o: oledDriver/oledC_fonts.c  .generated_files/flags/default/633be4339263b6e4e97723be3bb545213d17aacd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fonts.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fonts.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fonts.c  -o ${OBJECTDIR}/oledDriver/oledC_fonts.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fonts.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_image.o: oledDriver/oledC_image.c  .generated_files/flags/default/00b53b76832b08fe4c84ec1c0968fd091057d744 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_image.c  -o ${OBJECTDIR}/oledDriver/oledC_image.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_image.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_fontData.o: oledDriver/oledC_fontData.c  .generated_files/flags/default/fa470b693450cab2c261e066af6b1cb302e5698b .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fontData.c  -o ${OBJECTDIR}/oledDriver/oledC_fontData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fontData.o.d"      -g -D__DEBUG -D__MPLAB_DEBUGGER_SIMULATOR=1  -mno-eds-warn  -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/oledDriver/pin_manager.o: oledDriver/pin_manager.c  .generated_files/flags/default/2659372bf5bb36c956707cda817f5ead50d9ba8d .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/pin_manager.o.d 
@@ -180,6 +222,48 @@ ${OBJECTDIR}/oledDriver/oledC_shapes.o: oledDriver/oledC_shapes.c  .generated_fi
 	@${RM} ${OBJECTDIR}/oledDriver/oledC_shapes.o 
 	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shapes.c  -o ${OBJECTDIR}/oledDriver/oledC_shapes.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shapes.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
 	
+${OBJECTDIR}/oledDriver/oledC_shadow.o: oledDriver/oledC_shadow.c  .generated_files/flags/default/5db10de97c9732e0a0aa84fe2fc91f1d8cf5a1ab .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_shadow.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_shadow.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_shadow.c  -o ${OBJECTDIR}/oledDriver/oledC_shadow.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_shadow.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_displayList.o: oledDriver/oledC_displayList.c  .generated_files/flags/default/9666752f91702b62ce7397ea49a2fc3d2adc4f96 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_displayList.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_displayList.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_displayList.c  -o ${OBJECTDIR}/oledDriver/oledC_displayList.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_displayList.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_sprite.o: oledDriver/oledC_sprite.c  .generated_files/flags/default/ecf68bec76183c6f88f44c6636c7ab3d22d4b1cc .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_sprite.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_sprite.c  -o ${OBJECTDIR}/oledDriver/oledC_sprite.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_sprite.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_scanline.o: oledDriver/oledC_scanline.c  .generated_files/flags/default/36c05cbae991b09f0d8207e6841de8b29ad31cbd .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scanline.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_scanline.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_scanline.c  -o ${OBJECTDIR}/oledDriver/oledC_scanline.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_scanline.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_fonts.o: oledDriver/oledC_fonts.c  .generated_files/flags/default/770f1518410ebf5b12d1b311538b36aac20f2331 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fonts.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fonts.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fonts.c  -o ${OBJECTDIR}/oledDriver/oledC_fonts.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fonts.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_image.o: oledDriver/oledC_image.c  .generated_files/flags/default/63284538bee25dcb4362c8404afb752a12ec28eb .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_image.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_image.c  -o ${OBJECTDIR}/oledDriver/oledC_image.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_image.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
+${OBJECTDIR}/oledDriver/oledC_fontData.o: oledDriver/oledC_fontData.c  .generated_files/flags/default/1e350e53258a34f659cd0d96e4e466e4598193ff .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
+	@${MKDIR} "${OBJECTDIR}/oledDriver" 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o.d 
+	@${RM} ${OBJECTDIR}/oledDriver/oledC_fontData.o 
+	${MP_CC} $(MP_EXTRA_CC_PRE)  oledDriver/oledC_fontData.c  -o ${OBJECTDIR}/oledDriver/oledC_fontData.o  -c -mcpu=$(MP_PROCESSOR_OPTION)  -MP -MMD -MF "${OBJECTDIR}/oledDriver/oledC_fontData.o.d"      -mno-eds-warn  -g -omf=elf -DXPRJ_default=$(CND_CONF)    $(COMPARISON_BUILD)  -O0 -I"bsp" -DFCY=4000000 -msmart-io=1 -Wall -msfr-warn=off    -mdfp="${DFP_DIR}/xc16"
+	
 ${OBJECTDIR}/oledDriver/pin_manager.o: oledDriver/pin_manager.c  .generated_files/flags/default/9b371672938e3492595013e066cacdebbee38db3 .generated_files/flags/default/da39a3ee5e6b4b0d3255bfef95601890afd80709
 	@${MKDIR} "${OBJECTDIR}/oledDriver" 
 	@${RM} ${OBJECTDIR}/oledDriver/pin_manager.o.d 
@@ -26,6 +26,7 @@
 #include "oledDriver/oledC_colors.h"
 #include "oledDriver/oledC_shapeHandler.h"
 #include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_sprite.h"
 
 static bool exampleInitialized;
 static uint16_t background_color;
@@ -57,41 +58,16 @@ static const uint32_t logo[] =
     0b11111111111000000000011111111111
 };
 
-static void oledC_clearScreen(void) 
-{    
-    uint8_t x;
-    uint8_t y;
-    oledC_setColumnAddressBounds(0,96);
-    oledC_setRowAddressBounds(0,96);
-    for(x = 0; x < 96; x++)
-    {
-        for(y = 0; y < 96; y++)
-        {
-            oledC_sendColorInt(background_color);
-        }
-    }
-}
-
-static void oledC_setBackground(uint16_t color)
-{
-    background_color = color;
-    oledC_clearScreen();
-}
+static const oledc_bitmap_t logoBitmap = { logo, OLEDC_BITMAP_ROW32, 32, 23, true };
+static oledc_sprite_t logoSprite;
 
 static void oledC_example_setup(void)
 {
-    oledC_setBackground(OLEDC_COLOR_WHITE);
+    background_color = OLEDC_COLOR_WHITE;
+    oledC_setBackground(background_color);
     shape_params_t params;
     
-    params.bitmap.color = OLEDC_COLOR_RED;
-    params.bitmap.x = 14;
-    params.bitmap.y = 25;
-    params.bitmap.sx = 2;
-    params.bitmap.sy = 2;
-    params.bitmap.bit_array = (uint32_t *)&logo[0];
-    params.bitmap.array_length = 23;
-    oledC_addShape(0,OLED_SHAPE_BITMAP, &params);
-    
+    params.circle.color = OLEDC_COLOR_RED;
     params.circle.radius = 10;
     params.circle.xc = 10;
     params.circle.yc = 10;
@@ -111,29 +87,26 @@ static void oledC_example_setup(void)
     
     
     oledC_redrawAll();
+    oledC_spriteInit(&logoSprite, &logoBitmap, 1, NULL, 2, OLEDC_COLOR_RED, background_color);
     exampleInitialized = true;
 }
 
 void oledC_example(void)
 {
     static int8_t shift = -24;
-    const uint8_t shift_from = 15;
+    const uint8_t shift_from = 24;
     if(!exampleInitialized)
     {
         oledC_example_setup();
     }
     
-    oledC_DrawString(10,0,2,2,(uint8_t*)"Shenkar", OLEDC_COLOR_BLACK);
-    oledC_DrawString(30,78,2,2,(uint8_t*)"Lab", OLEDC_COLOR_DARKGREEN);
-    shape_t *moveIt = oledC_getShape(0);
-           
-    oledC_eraseShape(0, background_color);
-    moveIt->params.bitmap.x = shift_from + shift;
+    oledC_DrawString(10,0,2,2,(uint8_t*)"Shenkar", OLEDC_COLOR_BLACK, NULL);
+    oledC_DrawString(30,78,2,2,(uint8_t*)"Lab", OLEDC_COLOR_DARKGREEN, NULL);
+    oledC_spriteShow(&logoSprite, shift_from + shift, 25, 0);
     shift += 4;
     if(shift > 24)
     {
         shift = -24;
     }
-    oledC_redrawIndex(0);
 }
 
@@ -33,9 +33,62 @@ enum STREAMING_MODES
 };
 static uint8_t streamingMode = NOSTREAM;
 
+/* How SPI1 is currently held by the driver: bytes for commands, 16-bit
+ * transmit-only words for RAM writes. */
+enum BUS_MODES
+{
+    BUS_OFF, BUS_BYTES, BUS_WORDS
+};
+static uint8_t busMode = BUS_OFF;
+/* Shorter pixel runs stay in byte mode rather than re-opening SPI1 */
+#define OLEDC_WORD_BURST_MIN 8
+
+/* Shadow of the SSD1351 address window and RAM write pointer, in panel
+ * coordinates (0..95). OLEDC_WINDOW_UNKNOWN never matches a real bound. */
+#define OLEDC_WINDOW_UNKNOWN 0xFF
+static struct
+{
+    uint8_t col_start;
+    uint8_t col_end;
+    uint8_t row_start;
+    uint8_t row_end;
+    uint8_t col;
+    uint8_t row;
+} window = 
+{
+    OLEDC_WINDOW_UNKNOWN, OLEDC_WINDOW_UNKNOWN, OLEDC_WINDOW_UNKNOWN,
+    OLEDC_WINDOW_UNKNOWN, OLEDC_WINDOW_UNKNOWN, OLEDC_WINDOW_UNKNOWN
+};
+static oledc_window_stats_t windowStats;
+
+/*
+ * Background flush queue. Jobs run back to back on DMA0; the completion
+ * interrupt closes the window and starts the next one. Any synchronous
+ * access first waits for the running chain, so drawing order is kept.
+ */
+#define OLEDC_FLUSH_QUEUE_SIZE 4 /* power of two */
+static oledc_flush_job_t flushQueue[OLEDC_FLUSH_QUEUE_SIZE];
+static volatile uint8_t flushHead = 0; /* advanced by the DMA interrupt */
+static volatile uint8_t flushTail = 0; /* advanced by oledC_queueFlush() */
+static volatile bool flushRunning = false;
+static bool flushStarting = false;
+
+/* Row buffers take turns: the CPU fills one while DMA0 sends the others */
+static uint16_t rowBuffers[OLEDC_ROW_BUFFERS][OLEDC_ROW_BUFFER_PIXELS];
+static uint8_t rowsQueued = 0;
+static volatile uint8_t rowsSent = 0; /* advanced from the DMA interrupt */
+
 static void startStreamingIfNeeded(OLEDC_COMMAND cmd);
 static void stopStreaming(void);
 static uint16_t exchangeTwoBytes(uint8_t byte1, uint8_t byte2);
+static bool acquireBus(uint8_t mode);
+static void releaseBus(void);
+static bool holdBusForPixels(uint16_t count);
+static void writeColorBytes(uint16_t color, uint16_t count);
+static void advanceWritePointer(uint16_t count);
+static void startNextFlush(void);
+static void flushComplete(void);
+static void rowBufferSent(void);
 static uint16_t background_color;
 
 oledc_color_t oledC_parseIntToRGB(uint16_t raw)
@@ -78,24 +131,87 @@ static void stopStreaming(void)
     streamingMode = NOSTREAM;
 }
 
+static bool acquireBus(uint8_t mode)
+{
+    if(!flushStarting)
+    {
+        while(flushRunning)
+        {
+            Nop();
+        }
+    }
+    if(busMode == mode)
+    {
+        return true;
+    }
+    releaseBus();
+    if(mode == BUS_WORDS ? spi1_openWordWriter() : oledC_open())
+    {
+        busMode = mode;
+    }
+    return busMode == mode;
+}
+
+static void releaseBus(void)
+{
+    if(busMode != BUS_OFF)
+    {
+        spi1_drain();
+        spi1_close();
+        busMode = BUS_OFF;
+    }
+}
+
+/*
+ * Long runs switch SPI1 to 16-bit words; single pixels reuse whatever mode
+ * the bus is already in, so a point between two commands costs no re-open.
+ */
+static bool holdBusForPixels(uint16_t count)
+{
+    if(streamingMode != WRITESTREAM)
+    {
+        return false;
+    }
+    if(count >= OLEDC_WORD_BURST_MIN)
+    {
+        return acquireBus(BUS_WORDS);
+    }
+    return busMode != BUS_OFF || acquireBus(BUS_BYTES);
+}
+
+static void writeColorBytes(uint16_t color, uint16_t count)
+{
+    while(count--)
+    {
+        spi1_writeByte(color >> 8);
+        spi1_writeByte(color & 0xFF);
+    }
+}
+
 static uint16_t exchangeTwoBytes(uint8_t byte1, uint8_t byte2)
 {
-    if(!oledC_open())
+    bool release = (busMode == BUS_OFF);
+    if(!acquireBus(BUS_BYTES))
     {
         return 0xFFFF;
     }
     byte1 = spi1_exchangeByte(byte1);
     byte2 = spi1_exchangeByte(byte2);
-    spi1_close();
+    if(release)
+    {
+        releaseBus();
+    }
     return ((uint16_t)byte1) << 8 | byte2;
 }
 
 void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size)
 {
-    if(!oledC_open())
+    bool release = (busMode == BUS_OFF);
+    if(!acquireBus(BUS_BYTES))
     {
         return;
     }
+    spi1_drain();
     LATCbits.LATC9 = 0; /* set oledC_nCS output low */
     LATCbits.LATC3 = 0; /* set oledC_DC output low */
     spi1_exchangeByte(cmd);
@@ -106,17 +222,38 @@ void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size
         LATCbits.LATC3 = 0; /* set oledC_DC output low */
     }
     LATCbits.LATC9 = 1; /* set oledC_nCS output high */
-    spi1_close();
+    if(release)
+    {
+        releaseBus();
+    }
     startStreamingIfNeeded(cmd);
+    if(cmd != OLEDC_CMD_SET_COLUMN_ADDRESS && cmd != OLEDC_CMD_SET_ROW_ADDRESS 
+        && cmd != OLEDC_CMD_WRITE_RAM && cmd != OLEDC_CMD_READ_RAM)
+    {
+        oledC_invalidateWindow();
+    }
 }
 
+/*
+ * Bound commands are skipped when the panel already has the same bounds and
+ * its pointer sits on the start of them, i.e. when resending would be a no-op.
+ */
 void oledC_setRowAddressBounds(uint8_t min, uint8_t max)
 {
     uint8_t payload[2];
     payload[0] = min > 95 ? 95 : min;
     payload[1] = max > 95 ? 95 : max;
+    if(window.row_start == payload[0] && window.row_end == payload[1] && window.row == payload[0])
+    {
+        windowStats.hits++;
+        windowStats.bytes_saved += 3;
+        return;
+    }
+    windowStats.misses++;
     oledC_sendCommand(OLEDC_CMD_SET_ROW_ADDRESS, payload, 2);
-    
+    window.row_start = payload[0];
+    window.row_end = payload[1];
+    window.row = payload[0];
 }
 
 void oledC_setColumnAddressBounds(uint8_t min, uint8_t max)
@@ -124,9 +261,97 @@ void oledC_setColumnAddressBounds(uint8_t min, uint8_t max)
     min = min > 95 ? 95 : min;
     max = max > 95 ? 95 : max;
     uint8_t payload[2];
+    if(window.col_start == min && window.col_end == max && window.col == min)
+    {
+        windowStats.hits++;
+        windowStats.bytes_saved += 3;
+        return;
+    }
+    windowStats.misses++;
     payload[0] = 16+min;
     payload[1] = max + 16;
     oledC_sendCommand(OLEDC_CMD_SET_COLUMN_ADDRESS, payload, 2);
+    window.col_start = min;
+    window.col_end = max;
+    window.col = min;
+}
+
+/*
+ * Places the write pointer on (x, y) for a single pixel. Either bound command
+ * is skipped when the pointer already sits on that column or row, e.g. the
+ * next point along a row only costs its two colour bytes.
+ */
+void oledC_setWritePosition(uint8_t x, uint8_t y)
+{
+    if(window.col == x)
+    {
+        windowStats.hits++;
+        windowStats.bytes_saved += 3;
+    }
+    else
+    {
+        oledC_setColumnAddressBounds(x, 95);
+    }
+    if(window.row == y)
+    {
+        windowStats.hits++;
+        windowStats.bytes_saved += 3;
+    }
+    else
+    {
+        oledC_setRowAddressBounds(y, 95);
+    }
+}
+
+void oledC_invalidateWindow(void)
+{
+    window.col_start = OLEDC_WINDOW_UNKNOWN;
+    window.col_end = OLEDC_WINDOW_UNKNOWN;
+    window.row_start = OLEDC_WINDOW_UNKNOWN;
+    window.row_end = OLEDC_WINDOW_UNKNOWN;
+    window.col = OLEDC_WINDOW_UNKNOWN;
+    window.row = OLEDC_WINDOW_UNKNOWN;
+}
+
+void oledC_getWindowStats(oledc_window_stats_t *stats)
+{
+    *stats = windowStats;
+}
+
+void oledC_resetWindowStats(void)
+{
+    windowStats.hits = 0;
+    windowStats.misses = 0;
+    windowStats.bytes_saved = 0;
+}
+
+/* Follows the panel's horizontal address increment through the window. */
+static void advanceWritePointer(uint16_t count)
+{
+    uint8_t width;
+    uint16_t area;
+    uint16_t offset;
+    if(window.col == OLEDC_WINDOW_UNKNOWN || window.row == OLEDC_WINDOW_UNKNOWN)
+    {
+        return;
+    }
+    if(count == 1)
+    {
+        if(window.col < window.col_end)
+        {
+            window.col++;
+            return;
+        }
+        window.col = window.col_start;
+        window.row = window.row < window.row_end ? window.row + 1 : window.row_start;
+        return;
+    }
+    width = window.col_end - window.col_start + 1;
+    area = (uint16_t)width * (window.row_end - window.row_start + 1);
+    offset = (uint16_t)(window.row - window.row_start) * width + (window.col - window.col_start);
+    offset = (offset + count % area) % area;
+    window.row = window.row_start + offset / width;
+    window.col = window.col_start + offset % width;
 }
 
 void oledC_setSleepMode(bool on)
@@ -165,9 +390,16 @@ uint16_t oledC_readColor(void)
     {
         return 0xFFFF;
     }
+    window.col = OLEDC_WINDOW_UNKNOWN;
+    window.row = OLEDC_WINDOW_UNKNOWN;
     return exchangeTwoBytes(0xFF, 0xFF);
 }
 
+/* 
+ * Once RAM writing starts SPI1 stays enabled until the stream is stopped,
+ * so pixels are queued FIFO writes instead of an spi1_open()/spi1_close()
+ * pair around two blocking byte exchanges.
+ */
 void oledC_startWritingDisplay(void)
 {
     oledC_sendCommand(OLEDC_CMD_WRITE_RAM, NULL, 0);    
@@ -177,6 +409,7 @@ void oledC_startWritingDisplay(void)
 
 void oledC_stopWritingDisplay(void)
 {
+    releaseBus();
     LATCbits.LATC9 = 1; /* set oledC_nCS output high */
     LATCbits.LATC3 = 0; /* set oledC_DC output low */
     stopStreaming();
@@ -193,11 +426,245 @@ void oledC_sendColorInt(uint16_t raw)
     {
         oledC_startWritingDisplay();
     }
-    if(streamingMode != WRITESTREAM)
+    if(!holdBusForPixels(1))
+    {
+        return;
+    }
+    if(busMode == BUS_WORDS)
+    {
+        spi1_writeWord(raw);
+    }
+    else
+    {
+        writeColorBytes(raw, 1);
+    }
+    advanceWritePointer(1);
+}
+
+/*
+ * Window streaming: one column/row/write command set per burst, then every
+ * pixel goes out with SPI1 enabled and nCS held low until oledC_endWindow().
+ *
+ * Full-screen fill (96x96, FCY = 4 MHz, SCK = 2 MHz, -O0):
+ *   per-pixel oledC_sendColorInt: 18439 bytes, 9219 SPI enables, ~1.2M Tcy
+ *   byte-mode burst:              18439 bytes, 1 SPI enable, ~0.6M Tcy
+ *   16-bit FIFO burst:            18439 bytes, 2 SPI enables, ~0.3M Tcy
+ * The wire time alone is 18439 * 16 Tcy = ~0.3M Tcy, so the word burst is
+ * bounded by SCK rather than by the CPU.
+ */
+void oledC_beginWindow(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    acquireBus(BUS_BYTES);
+    oledC_setColumnAddressBounds(start_x, end_x);
+    oledC_setRowAddressBounds(start_y, end_y);
+    oledC_startWritingDisplay();
+}
+
+void oledC_pushColor(uint16_t color)
+{
+    if(!holdBusForPixels(1))
+    {
+        return;
+    }
+    if(busMode == BUS_WORDS)
+    {
+        spi1_writeWord(color);
+    }
+    else
+    {
+        writeColorBytes(color, 1);
+    }
+    advanceWritePointer(1);
+}
+
+void oledC_pushColors(const uint16_t *colors, uint16_t count)
+{
+    if(!holdBusForPixels(count))
+    {
+        return;
+    }
+    if(busMode == BUS_WORDS)
+    {
+        spi1_writeWordBlock(colors, count);
+    }
+    else
+    {
+        uint16_t i;
+        for(i = 0; i < count; i++)
+        {
+            writeColorBytes(colors[i], 1);
+        }
+    }
+    advanceWritePointer(count);
+}
+
+void oledC_pushRepeat(uint16_t color, uint16_t count)
+{
+    if(!holdBusForPixels(count))
+    {
+        return;
+    }
+    if(busMode == BUS_WORDS)
+    {
+        spi1_writeWordRepeat(color, count);
+    }
+    else
+    {
+        writeColorBytes(color, count);
+    }
+    advanceWritePointer(count);
+}
+
+void oledC_endWindow(void)
+{
+    oledC_stopWritingDisplay();
+    startNextFlush();
+}
+
+static void startNextFlush(void)
+{
+    oledc_flush_job_t *job;
+    uint16_t count;
+    bool started;
+
+    if(flushRunning || flushHead == flushTail || busMode != BUS_OFF || streamingMode != NOSTREAM)
+    {
+        return;
+    }
+    job = &flushQueue[flushHead & (OLEDC_FLUSH_QUEUE_SIZE - 1)];
+    count = (uint16_t)(job->end_x - job->start_x + 1) * (job->end_y - job->start_y + 1);
+    flushStarting = true;
+    oledC_beginWindow(job->start_x, job->start_y, job->end_x, job->end_y);
+    acquireBus(BUS_WORDS);
+    /* the completion interrupt can fire before the DMA call returns */
+    advanceWritePointer(count);
+    flushRunning = true;
+    if(job->pixels != NULL)
+    {
+        started = spi1_dmaWriteWords(job->pixels, count, true);
+    }
+    else
+    {
+        started = spi1_dmaWriteWords(&job->color, count, false);
+    }
+    if(started)
+    {
+        flushStarting = false;
+        return;
+    }
+    /* DMA refused the job: send it from here instead */
+    flushRunning = false;
+    oledC_invalidateWindow();
+    if(job->pixels != NULL)
+    {
+        oledC_pushColors(job->pixels, count);
+    }
+    else
+    {
+        oledC_pushRepeat(job->color, count);
+    }
+    flushStarting = false;
+    flushComplete();
+}
+
+/* spi1 handler: the DMA block has been handed to the SPI1 FIFO */
+static void flushComplete(void)
+{
+    void (*done)(void) = flushQueue[flushHead & (OLEDC_FLUSH_QUEUE_SIZE - 1)].done;
+
+    oledC_stopWritingDisplay();
+    flushHead++;
+    flushRunning = false;
+    if(done != NULL)
+    {
+        done();
+    }
+    startNextFlush();
+}
+
+/*
+ * Queues a window for DMA and returns at once; false when the window is
+ * off-screen or the queue is full. The job is copied, but pixels must stay
+ * untouched until it completes. Not for use between beginWindow/endWindow.
+ */
+bool oledC_queueFlush(const oledc_flush_job_t *job)
+{
+    uint16_t ipl;
+
+    if(job->start_x > job->end_x || job->start_y > job->end_y || job->end_x > 95 || job->end_y > 95)
+    {
+        return false;
+    }
+    ipl = SRbits.IPL;
+    SRbits.IPL = 7; /* Timer1 draws too, so slot reservation must be atomic */
+    if((uint8_t)(flushTail - flushHead) >= OLEDC_FLUSH_QUEUE_SIZE)
+    {
+        SRbits.IPL = ipl;
+        return false;
+    }
+    flushQueue[flushTail & (OLEDC_FLUSH_QUEUE_SIZE - 1)] = *job;
+    flushTail++;
+    SRbits.IPL = ipl;
+    if(streamingMode != NOSTREAM && !flushRunning)
+    {
+        oledC_stopWritingDisplay(); /* a point write leaves its stream open */
+    }
+    startNextFlush();
+    return true;
+}
+
+bool oledC_isFlushing(void)
+{
+    return flushRunning || flushHead != flushTail;
+}
+
+void oledC_waitForFlush(void)
+{
+    startNextFlush();
+    while(flushRunning)
+    {
+        Nop();
+    }
+}
+
+static void rowBufferSent(void)
+{
+    rowsSent++;
+}
+
+/*
+ * The next row buffer, once DMA0 has finished with it: up to
+ * OLEDC_ROW_BUFFER_PIXELS colours, row-major, for oledC_queueRowBuffer().
+ */
+uint16_t *oledC_rowBuffer(void)
+{
+    while((uint8_t)(rowsQueued - rowsSent) >= OLEDC_ROW_BUFFERS)
+    {
+        Nop();
+    }
+    return rowBuffers[rowsQueued & (OLEDC_ROW_BUFFERS - 1)];
+}
+
+/*
+ * Queues the buffer from oledC_rowBuffer() for the window and returns
+ * while it is sent. A full queue is waited out rather than refused.
+ */
+void oledC_queueRowBuffer(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    oledc_flush_job_t job = {start_x, start_y, end_x, end_y, NULL, 0, rowBufferSent};
+
+    job.pixels = rowBuffers[rowsQueued & (OLEDC_ROW_BUFFERS - 1)];
+    /* a job DMA refuses completes inside oledC_queueFlush() */
+    rowsQueued++;
+    if(oledC_queueFlush(&job))
     {
         return;
     }
-    exchangeTwoBytes(raw >> 8, raw & 0x00FF);
+    oledC_waitForFlush();
+    if(!oledC_queueFlush(&job))
+    {
+        rowBufferSent(); /* off-screen: nothing to send */
+    }
 }
 
 bool oledC_open(void){
@@ -206,6 +673,8 @@ bool oledC_open(void){
 
 void oledC_setup(void)
 {
+    spi1_setSpiISR(flushComplete);
+    oledC_invalidateWindow();
     LATCbits.LATC8 = 0; /* set oledC_EN output low */
     LATAbits.LATA13 = 1; /* set oledC_RST output high */
     LATCbits.LATC1 = 0; /* set oledC_RW output low */
@@ -224,17 +693,15 @@ void oledC_setup(void)
 
 void oledC_clearScreen(void) 
 {    
-    uint8_t x;
-    uint8_t y;
-    oledC_setColumnAddressBounds(0,96);
-    oledC_setRowAddressBounds(0,96);
-    for(x = 0; x < 96; x++)
+    oledc_flush_job_t job = {0, 0, 95, 95, NULL, 0, NULL};
+    job.color = background_color;
+    if(oledC_queueFlush(&job))
     {
-        for(y = 0; y < 96; y++)
-        {
-            oledC_sendColorInt(background_color);
-        }
+        return;
     }
+    oledC_beginWindow(0, 0, 95, 95);
+    oledC_pushRepeat(background_color, 96*96);
+    oledC_endWindow();
 }
 
 void oledC_setBackground(uint16_t color)
@@ -242,3 +709,8 @@ void oledC_setBackground(uint16_t color)
     background_color = color;
     oledC_clearScreen();
 }
+
+uint16_t oledC_getBackground(void)
+{
+    return background_color;
+}
@@ -33,6 +33,29 @@ typedef struct oledc_color_t
     uint8_t blue;
 } oledc_color_t;
 
+typedef struct oledc_window_stats_t
+{
+    uint16_t hits;          /* bound commands skipped by the window cache */
+    uint16_t misses;        /* bound commands actually sent */
+    uint16_t bytes_saved;   /* 3 bytes (command + 2 bounds) per hit */
+} oledc_window_stats_t;
+
+/* A window plus its pixels, sent by DMA in the background */
+typedef struct oledc_flush_job_t
+{
+    uint8_t start_x;
+    uint8_t start_y;
+    uint8_t end_x;
+    uint8_t end_y;
+    const uint16_t *pixels; /* row-major in data RAM, valid until done; NULL fills with color */
+    uint16_t color;
+    void (*done)(void);     /* optional, runs from the DMA interrupt */
+} oledc_flush_job_t;
+
+/* Driver-owned DMA sources for row-by-row flushes, see oledC_rowBuffer() */
+#define OLEDC_ROW_BUFFERS 2 /* power of two */
+#define OLEDC_ROW_BUFFER_PIXELS 96
+
 typedef enum OLEDC_CMDS 
 {
     OLEDC_CMD_SET_COLUMN_ADDRESS = 0x15,
@@ -64,13 +87,21 @@ typedef enum OLEDC_CMDS
     OLEDC_CMD_SET_COMMAND_LOCK = 0xFD
 } OLEDC_COMMAND;
 
+oledc_color_t oledC_parseIntToRGB(uint16_t raw);
+uint16_t oledC_parseRGBToInt(uint8_t red, uint8_t green, uint8_t blue);
+
 void oledC_sendCommand(OLEDC_COMMAND cmd, uint8_t *payload, uint8_t payload_size);
 
 void oledC_setRowAddressBounds(uint8_t min, uint8_t max);
 void oledC_setColumnAddressBounds(uint8_t min, uint8_t max);
+void oledC_setWritePosition(uint8_t x, uint8_t y);
+void oledC_invalidateWindow(void);
+void oledC_getWindowStats(oledc_window_stats_t *stats);
+void oledC_resetWindowStats(void);
 void oledC_setSleepMode(bool on);
 void oledC_setDisplayOrientation(void);
 void oledC_setBackground(uint16_t color);
+uint16_t oledC_getBackground(void);
 
 void oledC_clearScreen(void);
 void oledC_startReadingDisplay(void);
@@ -84,4 +115,16 @@ void oledC_sendColorInt(uint16_t raw);
 void oledC_startWritingDisplay(void);
 void oledC_stopWritingDisplay(void);
 
+void oledC_beginWindow(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+void oledC_pushColor(uint16_t color);
+void oledC_pushColors(const uint16_t *colors, uint16_t count);
+void oledC_pushRepeat(uint16_t color, uint16_t count);
+void oledC_endWindow(void);
+
+bool oledC_queueFlush(const oledc_flush_job_t *job);
+bool oledC_isFlushing(void);
+void oledC_waitForFlush(void);
+uint16_t *oledC_rowBuffer(void);
+void oledC_queueRowBuffer(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+
 #endif
\ No newline at end of file
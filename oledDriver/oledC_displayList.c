@@ -0,0 +1,276 @@
+/*
+ * File:   oledC_displayList.c
+ *
+ * Each command is one filled rectangle. Commands may only trade places
+ * when they do not overlap, so every pass below keeps the order of any
+ * two commands that paint the same pixel and the frame looks exactly as
+ * if it had been drawn straight away.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_displayList.h"
+
+/* Column and row bound commands plus the write command */
+#define LIST_WINDOW_BYTES 7
+
+typedef struct list_command_t
+{
+    oledc_rect_t rect;
+    uint16_t color;
+} list_command_t;
+
+static list_command_t commands[OLEDC_LIST_MAX_COMMANDS];
+static uint8_t commandCount = 0;
+static uint8_t depth = 0;
+static const oledc_target_t *previousTarget = NULL;
+static const oledc_list_stats_t noStats = {0, 0, 0, 0, 0, 0};
+static oledc_list_stats_t frameStats;
+static oledc_list_stats_t lastStats;
+
+static void listFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+static bool intersects(const oledc_rect_t *a, const oledc_rect_t *b);
+static bool contains(const oledc_rect_t *outer, const oledc_rect_t *inner);
+static bool joins(const oledc_rect_t *a, const oledc_rect_t *b, oledc_rect_t *joined);
+static bool overlapsBetween(uint8_t first, uint8_t last, const oledc_rect_t *rect);
+static void dropCommand(uint8_t index);
+static void dropOverdrawn(void);
+static void mergeNeighbours(void);
+static void sortByAddress(void);
+
+static const oledc_target_t listTarget = { listFillRect };
+
+void oledC_listBegin(void)
+{
+    if(depth++ == 0)
+    {
+        previousTarget = oledC_setTarget(&listTarget);
+        commandCount = 0;
+        frameStats = noStats;
+    }
+}
+
+void oledC_listEnd(void)
+{
+    if(depth == 0 || --depth > 0)
+    {
+        return;
+    }
+    oledC_listFlush();
+    oledC_setTarget(previousTarget);
+    lastStats = frameStats;
+}
+
+void oledC_listGetStats(oledc_list_stats_t *stats)
+{
+    *stats = lastStats;
+}
+
+/* Rectangles arrive clipped to the panel by oledC_shapes.c */
+static void listFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    if(commandCount == OLEDC_LIST_MAX_COMMANDS)
+    {
+        oledC_listFlush();
+    }
+    commands[commandCount].rect.xs = start_x;
+    commands[commandCount].rect.ys = start_y;
+    commands[commandCount].rect.xe = end_x;
+    commands[commandCount].rect.ye = end_y;
+    commands[commandCount].color = color;
+    commandCount++;
+    frameStats.recorded++;
+}
+
+static bool intersects(const oledc_rect_t *a, const oledc_rect_t *b)
+{
+    return a->xs <= b->xe && a->xe >= b->xs && a->ys <= b->ye && a->ye >= b->ys;
+}
+
+static bool contains(const oledc_rect_t *outer, const oledc_rect_t *inner)
+{
+    return outer->xs <= inner->xs && outer->xe >= inner->xe && outer->ys <= inner->ys && outer->ye >= inner->ye;
+}
+
+/* True when a and b together are exactly one rectangle */
+static bool joins(const oledc_rect_t *a, const oledc_rect_t *b, oledc_rect_t *joined)
+{
+    if(contains(a, b))
+    {
+        *joined = *a;
+        return true;
+    }
+    if(contains(b, a))
+    {
+        *joined = *b;
+        return true;
+    }
+    if(a->xs == b->xs && a->xe == b->xe && a->ys <= b->ye + 1 && b->ys <= a->ye + 1)
+    {
+        *joined = *a;
+        joined->ys = a->ys < b->ys ? a->ys : b->ys;
+        joined->ye = a->ye > b->ye ? a->ye : b->ye;
+        return true;
+    }
+    if(a->ys == b->ys && a->ye == b->ye && a->xs <= b->xe + 1 && b->xs <= a->xe + 1)
+    {
+        *joined = *a;
+        joined->xs = a->xs < b->xs ? a->xs : b->xs;
+        joined->xe = a->xe > b->xe ? a->xe : b->xe;
+        return true;
+    }
+    return false;
+}
+
+/* Whether any command strictly between first and last touches rect */
+static bool overlapsBetween(uint8_t first, uint8_t last, const oledc_rect_t *rect)
+{
+    uint8_t k;
+    for(k = first + 1; k < last; k++)
+    {
+        if(intersects(&commands[k].rect, rect))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void dropCommand(uint8_t index)
+{
+    commandCount--;
+    for(; index < commandCount; index++)
+    {
+        commands[index] = commands[index + 1];
+    }
+}
+
+/* A command inside a later one never shows */
+static void dropOverdrawn(void)
+{
+    uint8_t i = 0, j;
+
+    while(i < commandCount)
+    {
+        for(j = i + 1; j < commandCount; j++)
+        {
+            if(contains(&commands[j].rect, &commands[i].rect))
+            {
+                break;
+            }
+        }
+        if(j < commandCount)
+        {
+            dropCommand(i);
+            frameStats.dropped++;
+        }
+        else
+        {
+            i++;
+        }
+    }
+}
+
+/*
+ * Two commands of one colour that make up one rectangle become one. The
+ * joined command takes the later slot when nothing in between overlaps
+ * the earlier one, or the earlier slot when nothing overlaps the later.
+ */
+static void mergeNeighbours(void)
+{
+    oledc_rect_t joined;
+    uint8_t i, j;
+    bool changed = true;
+
+    while(changed)
+    {
+        changed = false;
+        for(i = 0; i < commandCount; i++)
+        {
+            for(j = i + 1; j < commandCount; j++)
+            {
+                if(commands[i].color != commands[j].color || !joins(&commands[i].rect, &commands[j].rect, &joined))
+                {
+                    continue;
+                }
+                if(!overlapsBetween(i, j, &commands[i].rect))
+                {
+                    commands[j].rect = joined;
+                    dropCommand(i);
+                }
+                else if(!overlapsBetween(i, j, &commands[j].rect))
+                {
+                    commands[i].rect = joined;
+                    dropCommand(j);
+                }
+                else
+                {
+                    continue;
+                }
+                frameStats.merged++;
+                changed = true;
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * Insertion sort on the top-left address. A command only moves past
+ * commands it does not overlap, which keeps the painting order of every
+ * pixel.
+ */
+static void sortByAddress(void)
+{
+    list_command_t moving;
+    uint16_t key;
+    uint8_t i, j;
+
+    for(i = 1; i < commandCount; i++)
+    {
+        moving = commands[i];
+        key = (uint16_t)moving.rect.ys * (OLED_DIM_WIDTH + 1) + moving.rect.xs;
+        for(j = i; j > 0; j--)
+        {
+            if((uint16_t)commands[j - 1].rect.ys * (OLED_DIM_WIDTH + 1) + commands[j - 1].rect.xs <= key
+                || intersects(&commands[j - 1].rect, &moving.rect))
+            {
+                break;
+            }
+            commands[j] = commands[j - 1];
+        }
+        commands[j] = moving;
+    }
+}
+
+void oledC_listFlush(void)
+{
+    oledc_window_stats_t before, after;
+    const oledc_rect_t *rect;
+    uint8_t i;
+
+    if(commandCount == 0)
+    {
+        return;
+    }
+    dropOverdrawn();
+    mergeNeighbours();
+    sortByAddress();
+
+    oledC_getWindowStats(&before);
+    oledC_setTarget(previousTarget);
+    for(i = 0; i < commandCount; i++)
+    {
+        rect = &commands[i].rect;
+        oledC_fillPanelRect(rect->xs, rect->ys, rect->xe, rect->ye, commands[i].color);
+        frameStats.bytes += LIST_WINDOW_BYTES + 2UL * (rect->xe - rect->xs + 1) * (rect->ye - rect->ys + 1);
+    }
+    oledC_setTarget(&listTarget);
+    oledC_getWindowStats(&after);
+    frameStats.bytes -= (uint16_t)(after.bytes_saved - before.bytes_saved);
+    frameStats.sent += commandCount;
+    frameStats.flushes++;
+    commandCount = 0;
+}
@@ -0,0 +1,37 @@
+/*
+ * File:   oledC_displayList.h
+ *
+ * Deferred drawing. Between oledC_listBegin() and oledC_listEnd() every
+ * rectangle the primitives produce is recorded instead of sent; the end
+ * of the frame drops what later commands paint over, merges neighbours
+ * of the same colour, orders the rest by panel address and sends them in
+ * one pass.
+ */
+
+#ifndef OLEDC_DISPLAY_LIST_H
+#define	OLEDC_DISPLAY_LIST_H
+
+#include <stdint.h>
+#include "oledC_shapes.h"
+
+/* Commands held per frame; a full arena is flushed early */
+#define OLEDC_LIST_MAX_COMMANDS 128
+
+typedef struct oledc_list_stats_t
+{
+    uint16_t recorded;  /* rectangles drawn during the frame */
+    uint16_t dropped;   /* painted over entirely by a later one */
+    uint16_t merged;    /* folded into a neighbour */
+    uint16_t sent;      /* windows actually sent */
+    uint16_t flushes;   /* passes, more than one if the arena filled up */
+    uint32_t bytes;     /* SPI bytes sent, commands included */
+} oledc_list_stats_t;
+
+/* Nests; only the outermost End flushes and restores the previous target */
+void oledC_listBegin(void);
+void oledC_listEnd(void);
+void oledC_listFlush(void);
+/* Statistics of the last frame */
+void oledC_listGetStats(oledc_list_stats_t *stats);
+
+#endif	/* OLEDC_DISPLAY_LIST_H */
@@ -0,0 +1,288 @@
+/*
+ * File:   oledC_fontData.c
+ *
+ * Generated by tools/mkfonts.py - do not edit. The tables are const,
+ * so XC16 keeps them in program memory and reads them through PSV.
+ */
+
+#include <stdint.h>
+#include "oledC_fonts.h"
+
+static const uint8_t fontSmallBits[665] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x80,0xA0,0xA0,
+    0xA0,0x00,0x00,0x00,0x00,0x50,0x50,0xF8,0x50,0xF8,0x50,0x50,0x20,0x78,0xA0,0x70,
+    0x28,0xF0,0x20,0xC0,0xC8,0x10,0x20,0x40,0x98,0x18,0x40,0xA0,0xA0,0x40,0xA8,0x90,
+    0x68,0x60,0x60,0x40,0x80,0x00,0x00,0x00,0x20,0x40,0x80,0x80,0x80,0x40,0x20,0x80,
+    0x40,0x20,0x20,0x20,0x40,0x80,0x20,0xA8,0x70,0xF8,0x70,0xA8,0x20,0x00,0x20,0x20,
+    0xF8,0x20,0x20,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x80,0x00,0x00,0x00,0xF8,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x08,0x10,0x20,0x40,0x80,0x00,
+    0x70,0x88,0x98,0xA8,0xC8,0x88,0x70,0x40,0xC0,0x40,0x40,0x40,0x40,0xE0,0x70,0x88,
+    0x08,0x70,0x80,0x80,0xF8,0xF8,0x08,0x10,0x30,0x08,0x88,0x70,0x10,0x30,0x50,0x90,
+    0xF8,0x10,0x10,0xF8,0x80,0xF0,0x08,0x08,0x88,0x70,0x38,0x40,0x80,0xF0,0x88,0x88,
+    0x70,0xF8,0x08,0x08,0x10,0x20,0x40,0x80,0x70,0x88,0x88,0x70,0x88,0x88,0x70,0x70,
+    0x88,0x88,0x78,0x08,0x10,0xE0,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x00,0x00,0x40,
+    0x00,0x40,0x40,0x80,0x10,0x20,0x40,0x80,0x40,0x20,0x10,0x00,0x00,0xF8,0x00,0xF8,
+    0x00,0x00,0x80,0x40,0x20,0x10,0x20,0x40,0x80,0x70,0x88,0x08,0x30,0x20,0x00,0x20,
+    0x70,0x88,0xA8,0xB8,0xB0,0x80,0x78,0x20,0x50,0x88,0x88,0xF8,0x88,0x88,0xF0,0x88,
+    0x88,0xF0,0x88,0x88,0xF0,0x70,0x88,0x80,0x80,0x80,0x88,0x70,0xF0,0x88,0x88,0x88,
+    0x88,0x88,0xF0,0xF8,0x80,0x80,0xF0,0x80,0x80,0xF8,0xF8,0x80,0x80,0xF0,0x80,0x80,
+    0x80,0x78,0x88,0x80,0x80,0x98,0x88,0x78,0x88,0x88,0x88,0xF8,0x88,0x88,0x88,0xE0,
+    0x40,0x40,0x40,0x40,0x40,0xE0,0x38,0x10,0x10,0x10,0x10,0x90,0x60,0x88,0x90,0xA0,
+    0xC0,0xA0,0x90,0x88,0x80,0x80,0x80,0x80,0x80,0x80,0xF8,0x88,0xD8,0xA8,0xA8,0xA8,
+    0x88,0x88,0x88,0x88,0xC8,0xA8,0x98,0x88,0x88,0x70,0x88,0x88,0x88,0x88,0x88,0x70,
+    0xF0,0x88,0x88,0xF0,0x80,0x80,0x80,0x70,0x88,0x88,0x88,0xA8,0x90,0x68,0xF0,0x88,
+    0x88,0xF0,0xA0,0x90,0x88,0x70,0x88,0x80,0x70,0x08,0x88,0x70,0xF8,0xA8,0x20,0x20,
+    0x20,0x20,0x20,0x88,0x88,0x88,0x88,0x88,0x88,0x70,0x88,0x88,0x88,0x88,0x88,0x50,
+    0x20,0x88,0x88,0x88,0xA8,0xA8,0xA8,0x50,0x88,0x88,0x50,0x20,0x50,0x88,0x88,0x88,
+    0x88,0x50,0x20,0x20,0x20,0x20,0xF8,0x08,0x10,0x70,0x40,0x80,0xF8,0xF0,0x80,0x80,
+    0x80,0x80,0x80,0xF0,0x00,0x80,0x40,0x20,0x10,0x08,0x00,0xF0,0x10,0x10,0x10,0x10,
+    0x10,0xF0,0x20,0x50,0x88,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,
+    0xC0,0xC0,0x40,0x20,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x70,0x90,0x68,0x80,0x80,
+    0xB0,0xC8,0x88,0xC8,0xB0,0x00,0x00,0x70,0x88,0x80,0x88,0x70,0x08,0x08,0x68,0x98,
+    0x88,0x98,0x68,0x00,0x00,0x70,0x88,0xF8,0x80,0x70,0x20,0x50,0x40,0xE0,0x40,0x40,
+    0x40,0x00,0x70,0x88,0x98,0x68,0x08,0x70,0x80,0x80,0xB0,0xC8,0x88,0x88,0x88,0x40,
+    0x00,0xC0,0x40,0x40,0x40,0xE0,0x10,0x00,0x10,0x10,0x10,0x90,0x60,0x80,0x80,0x90,
+    0xA0,0xC0,0xA0,0x90,0xC0,0x40,0x40,0x40,0x40,0x40,0xE0,0x00,0x00,0xD0,0xA8,0xA8,
+    0xA8,0xA8,0x00,0x00,0xB0,0xC8,0x88,0x88,0x88,0x00,0x00,0x70,0x88,0x88,0x88,0x70,
+    0x00,0x00,0xB0,0xC8,0xC8,0xB0,0x80,0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x00,0x00,
+    0xB0,0xC8,0x80,0x80,0x80,0x00,0x00,0x78,0x80,0x70,0x08,0xF0,0x20,0x20,0xF8,0x20,
+    0x20,0x28,0x10,0x00,0x00,0x88,0x88,0x88,0x98,0x68,0x00,0x00,0x88,0x88,0x88,0x50,
+    0x20,0x00,0x00,0x88,0x88,0xA8,0xA8,0x50,0x00,0x00,0x88,0x50,0x20,0x50,0x88,0x00,
+    0x00,0x88,0x88,0x78,0x08,0xF0,0x00,0x00,0xF8,0x10,0x20,0x40,0xF8,0x20,0x40,0x40,
+    0x80,0x40,0x40,0x20,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x40,0x40,0x20,0x40,
+    0x40,0x80,0x40,0xA8,0x10,0x00,0x00,0x00,0x00,
+};
+
+static const oledc_glyph_t fontSmallGlyphs[95] = {
+    {0,2}, {7,1}, {14,3}, {21,5}, {28,5}, {35,5},
+    {42,5}, {49,3}, {56,3}, {63,3}, {70,5}, {77,5},
+    {84,2}, {91,5}, {98,2}, {105,5}, {112,5}, {119,3},
+    {126,5}, {133,5}, {140,5}, {147,5}, {154,5}, {161,5},
+    {168,5}, {175,5}, {182,1}, {189,2}, {196,4}, {203,5},
+    {210,4}, {217,5}, {224,5}, {231,5}, {238,5}, {245,5},
+    {252,5}, {259,5}, {266,5}, {273,5}, {280,5}, {287,3},
+    {294,5}, {301,5}, {308,5}, {315,5}, {322,5}, {329,5},
+    {336,5}, {343,5}, {350,5}, {357,5}, {364,5}, {371,5},
+    {378,5}, {385,5}, {392,5}, {399,5}, {406,5}, {413,4},
+    {420,5}, {427,4}, {434,5}, {441,5}, {448,3}, {455,5},
+    {462,5}, {469,5}, {476,5}, {483,5}, {490,4}, {497,5},
+    {504,5}, {511,3}, {518,4}, {525,4}, {532,3}, {539,5},
+    {546,5}, {553,5}, {560,5}, {567,5}, {574,5}, {581,5},
+    {588,5}, {595,5}, {602,5}, {609,5}, {616,5}, {623,5},
+    {630,5}, {637,3}, {644,1}, {651,3}, {658,5},
+};
+
+const oledc_font_t oledC_fontSmall = {
+    7, 0x20, 0x7E, 1, 3, fontSmallGlyphs, fontSmallBits
+};
+
+static const uint8_t fontMediumBits[2310] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0xC0,0xC0,0xCC,0xCC,0xCC,0xCC,
+    0xCC,0xCC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x33,0x00,0x33,0x00,
+    0x33,0x00,0xFF,0xC0,0xFF,0xC0,0x33,0x00,0x33,0x00,0xFF,0xC0,0xFF,0xC0,0x33,0x00,
+    0x33,0x00,0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,0x3F,0xC0,0x3F,0xC0,0xCC,0x00,
+    0xCC,0x00,0x3F,0x00,0x3F,0x00,0x0C,0xC0,0x0C,0xC0,0xFF,0x00,0xFF,0x00,0x0C,0x00,
+    0x0C,0x00,0xF0,0x00,0xF0,0x00,0xF0,0xC0,0xF0,0xC0,0x03,0x00,0x03,0x00,0x0C,0x00,
+    0x0C,0x00,0x30,0x00,0x30,0x00,0xC3,0xC0,0xC3,0xC0,0x03,0xC0,0x03,0xC0,0x30,0x00,
+    0x30,0x00,0xCC,0x00,0xCC,0x00,0xCC,0x00,0xCC,0x00,0x30,0x00,0x30,0x00,0xCC,0xC0,
+    0xCC,0xC0,0xC3,0x00,0xC3,0x00,0x3C,0xC0,0x3C,0xC0,0x3C,0x3C,0x3C,0x3C,0x30,0x30,
+    0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0x30,0x30,0x0C,0x0C,0xC0,0xC0,0x30,0x30,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,
+    0x30,0x30,0xC0,0xC0,0x0C,0x00,0x0C,0x00,0xCC,0xC0,0xCC,0xC0,0x3F,0x00,0x3F,0x00,
+    0xFF,0xC0,0xFF,0xC0,0x3F,0x00,0x3F,0x00,0xCC,0xC0,0xCC,0xC0,0x0C,0x00,0x0C,0x00,
+    0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,0xFF,0xC0,
+    0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x03,0x00,0x03,0x00,
+    0x0C,0x00,0x0C,0x00,0x30,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
+    0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC3,0xC0,0xC3,0xC0,0xCC,0xC0,0xCC,0xC0,
+    0xF0,0xC0,0xF0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x30,0x30,0xF0,0xF0,
+    0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0xFC,0xFC,0x3F,0x00,0x3F,0x00,0xC0,0xC0,
+    0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x3F,0x00,0x3F,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xFF,0xC0,0xFF,0xC0,0xFF,0xC0,0xFF,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x00,
+    0x03,0x00,0x0F,0x00,0x0F,0x00,0x00,0xC0,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,
+    0x3F,0x00,0x03,0x00,0x03,0x00,0x0F,0x00,0x0F,0x00,0x33,0x00,0x33,0x00,0xC3,0x00,
+    0xC3,0x00,0xFF,0xC0,0xFF,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xFF,0xC0,
+    0xFF,0xC0,0xC0,0x00,0xC0,0x00,0xFF,0x00,0xFF,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,
+    0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x0F,0xC0,0x0F,0xC0,0x30,0x00,
+    0x30,0x00,0xC0,0x00,0xC0,0x00,0xFF,0x00,0xFF,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0x3F,0x00,0x3F,0x00,0xFF,0xC0,0xFF,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,
+    0x00,0xC0,0x03,0x00,0x03,0x00,0x0C,0x00,0x0C,0x00,0x30,0x00,0x30,0x00,0xC0,0x00,
+    0xC0,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,
+    0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x3F,0x00,
+    0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0xC0,0x3F,0xC0,0x00,0xC0,
+    0x00,0xC0,0x03,0x00,0x03,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,
+    0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x00,0x00,
+    0x30,0x30,0x30,0x30,0xC0,0xC0,0x03,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0x30,0x30,
+    0x0C,0x0C,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,
+    0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC0,0xC0,0x30,0x30,0x0C,0x0C,0x03,0x03,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0x3F,0x00,
+    0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x0F,0x00,0x0F,0x00,0x0C,0x00,
+    0x0C,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,
+    0xC0,0xC0,0xCC,0xC0,0xCC,0xC0,0xCF,0xC0,0xCF,0xC0,0xCF,0x00,0xCF,0x00,0xC0,0x00,
+    0xC0,0x00,0x3F,0xC0,0x3F,0xC0,0x0C,0x00,0x0C,0x00,0x33,0x00,0x33,0x00,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xC0,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xFF,0x00,0xFF,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0x00,
+    0xFF,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0x00,0xFF,0x00,0x3F,0x00,
+    0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0xFF,0x00,0xFF,0x00,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xFF,0x00,0xFF,0x00,0xFF,0xC0,0xFF,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xFF,0x00,0xFF,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFF,0xC0,
+    0xFF,0xC0,0xFF,0xC0,0xFF,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFF,0x00,
+    0xFF,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x3F,0xC0,
+    0x3F,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC3,0xC0,
+    0xC3,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0xC0,0x3F,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xC0,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFC,0xFC,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+    0x30,0x30,0xFC,0xFC,0x0F,0xC0,0x0F,0xC0,0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,
+    0x03,0x00,0x03,0x00,0x03,0x00,0x03,0x00,0xC3,0x00,0xC3,0x00,0x3C,0x00,0x3C,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC3,0x00,0xC3,0x00,0xCC,0x00,0xCC,0x00,0xF0,0x00,0xF0,0x00,
+    0xCC,0x00,0xCC,0x00,0xC3,0x00,0xC3,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xC0,0x00,0xFF,0xC0,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xF3,0xC0,0xF3,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xF0,0xC0,0xF0,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0xC3,0xC0,0xC3,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0xFF,0x00,0xFF,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0x00,0xFF,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xCC,0xC0,0xCC,0xC0,0xC3,0x00,0xC3,0x00,
+    0x3C,0xC0,0x3C,0xC0,0xFF,0x00,0xFF,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xFF,0x00,0xFF,0x00,0xCC,0x00,0xCC,0x00,0xC3,0x00,0xC3,0x00,0xC0,0xC0,0xC0,0xC0,
+    0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0x3F,0x00,0x3F,0x00,
+    0x00,0xC0,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0xFF,0xC0,0xFF,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,
+    0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xCC,0xC0,0xCC,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0x33,0x00,0x33,0x00,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,0x33,0x00,0x33,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,
+    0x0C,0x00,0x0C,0x00,0xFF,0xC0,0xFF,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x00,0x03,0x00,
+    0x3F,0x00,0x3F,0x00,0x30,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,0xFF,0xC0,0xFF,0xC0,
+    0xFF,0xFF,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFF,0xFF,0x00,0x00,
+    0x00,0x00,0xC0,0x00,0xC0,0x00,0x30,0x00,0x30,0x00,0x0C,0x00,0x0C,0x00,0x03,0x00,
+    0x03,0x00,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0xFF,0xFF,0x03,0x03,0x03,0x03,
+    0x03,0x03,0x03,0x03,0x03,0x03,0xFF,0xFF,0x0C,0x00,0x0C,0x00,0x33,0x00,0x33,0x00,
+    0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,
+    0xF0,0xF0,0xF0,0xF0,0x30,0x30,0x0C,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x3C,0x00,0x03,0x00,0x03,0x00,0x3F,0x00,
+    0x3F,0x00,0xC3,0x00,0xC3,0x00,0x3C,0xC0,0x3C,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0xC0,0x00,0xCF,0x00,0xCF,0x00,0xF0,0xC0,0xF0,0xC0,0xC0,0xC0,0xC0,0xC0,0xF0,0xC0,
+    0xF0,0xC0,0xCF,0x00,0xCF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,
+    0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,
+    0x3F,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x3C,0xC0,0x3C,0xC0,0xC3,0xC0,
+    0xC3,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC0,0xC3,0xC0,0x3C,0xC0,0x3C,0xC0,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xFF,0xC0,
+    0xFF,0xC0,0xC0,0x00,0xC0,0x00,0x3F,0x00,0x3F,0x00,0x0C,0x0C,0x33,0x33,0x30,0x30,
+    0xFC,0xFC,0x30,0x30,0x30,0x30,0x30,0x30,0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC3,0xC0,0xC3,0xC0,0x3C,0xC0,0x3C,0xC0,0x00,0xC0,0x00,0xC0,
+    0x3F,0x00,0x3F,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xCF,0x00,0xCF,0x00,
+    0xF0,0xC0,0xF0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0x30,0x30,0x00,0x00,0xF0,0xF0,0x30,0x30,0x30,0x30,0x30,0x30,0xFC,0xFC,0x03,0x03,
+    0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0xC3,0xC3,0x3C,0x3C,0xC0,0xC0,0xC0,0xC0,
+    0xC3,0xC3,0xCC,0xCC,0xF0,0xF0,0xCC,0xCC,0xC3,0xC3,0xF0,0xF0,0x30,0x30,0x30,0x30,
+    0x30,0x30,0x30,0x30,0x30,0x30,0xFC,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xF3,0x00,0xF3,0x00,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x00,0xCF,0x00,
+    0xF0,0xC0,0xF0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xCF,0x00,0xCF,0x00,0xF0,0xC0,0xF0,0xC0,0xF0,0xC0,0xF0,0xC0,
+    0xCF,0x00,0xCF,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x3C,0xC0,0x3C,0xC0,0xC3,0xC0,0xC3,0xC0,0xC3,0xC0,0xC3,0xC0,0x3C,0xC0,0x3C,0xC0,
+    0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xCF,0x00,0xCF,0x00,
+    0xF0,0xC0,0xF0,0xC0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC0,0x3F,0xC0,0xC0,0x00,0xC0,0x00,
+    0x3F,0x00,0x3F,0x00,0x00,0xC0,0x00,0xC0,0xFF,0x00,0xFF,0x00,0x0C,0x00,0x0C,0x00,
+    0x0C,0x00,0x0C,0x00,0xFF,0xC0,0xFF,0xC0,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,
+    0x0C,0xC0,0x0C,0xC0,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC3,0xC0,0xC3,0xC0,
+    0x3C,0xC0,0x3C,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,
+    0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0xCC,0xC0,0x33,0x00,0x33,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0xC0,0xC0,0xC0,0xC0,0x33,0x00,0x33,0x00,0x0C,0x00,0x0C,0x00,
+    0x33,0x00,0x33,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0xC0,0x3F,0xC0,0x00,0xC0,0x00,0xC0,
+    0xFF,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,
+    0x03,0x00,0x03,0x00,0x0C,0x00,0x0C,0x00,0x30,0x00,0x30,0x00,0xFF,0xC0,0xFF,0xC0,
+    0x0C,0x0C,0x30,0x30,0x30,0x30,0xC0,0xC0,0x30,0x30,0x30,0x30,0x0C,0x0C,0xC0,0xC0,
+    0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x30,0x30,
+    0x30,0x30,0x0C,0x0C,0x30,0x30,0x30,0x30,0xC0,0xC0,0x30,0x00,0x30,0x00,0xCC,0xC0,
+    0xCC,0xC0,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const oledc_glyph_t fontMediumGlyphs[95] = {
+    {0,4}, {14,2}, {28,6}, {42,10}, {70,10}, {98,10},
+    {126,10}, {154,6}, {168,6}, {182,6}, {196,10}, {224,10},
+    {252,4}, {266,10}, {294,4}, {308,10}, {336,10}, {364,6},
+    {378,10}, {406,10}, {434,10}, {462,10}, {490,10}, {518,10},
+    {546,10}, {574,10}, {602,2}, {616,4}, {630,8}, {644,10},
+    {672,8}, {686,10}, {714,10}, {742,10}, {770,10}, {798,10},
+    {826,10}, {854,10}, {882,10}, {910,10}, {938,10}, {966,6},
+    {980,10}, {1008,10}, {1036,10}, {1064,10}, {1092,10}, {1120,10},
+    {1148,10}, {1176,10}, {1204,10}, {1232,10}, {1260,10}, {1288,10},
+    {1316,10}, {1344,10}, {1372,10}, {1400,10}, {1428,10}, {1456,8},
+    {1470,10}, {1498,8}, {1512,10}, {1540,10}, {1568,6}, {1582,10},
+    {1610,10}, {1638,10}, {1666,10}, {1694,10}, {1722,8}, {1736,10},
+    {1764,10}, {1792,6}, {1806,8}, {1820,8}, {1834,6}, {1848,10},
+    {1876,10}, {1904,10}, {1932,10}, {1960,10}, {1988,10}, {2016,10},
+    {2044,10}, {2072,10}, {2100,10}, {2128,10}, {2156,10}, {2184,10},
+    {2212,10}, {2240,6}, {2254,2}, {2268,6}, {2282,10},
+};
+
+const oledc_font_t oledC_fontMedium = {
+    14, 0x20, 0x7E, 2, 6, fontMediumGlyphs, fontMediumBits
+};
+
+static const uint8_t fontLargeBits[441] = {
+    0x7F,0xE0,0xFF,0xF0,0xFF,0xF0,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xE0,0x70,0xE0,0x70,0xFF,0xF0,0xFF,0xF0,0x7F,0xE0,0x00,0x00,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x00,0x7F,0xE0,0x7F,0xF0,0x7F,0xF0,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x7F,0xF0,0xFF,0xF0,0xFF,0xE0,0xE0,0x00,0xE0,0x00,
+    0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xFF,0xE0,0xFF,0xE0,0x7F,0xE0,0x7F,0xE0,
+    0x7F,0xF0,0x7F,0xF0,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x7F,0xF0,0x7F,0xF0,0x7F,0xF0,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x7F,0xF0,0x7F,0xF0,0x7F,0xE0,0x00,0x00,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xFF,0xF0,0xFF,0xF0,0x7F,0xF0,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x00,0x7F,0xE0,0xFF,0xE0,0xFF,0xE0,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,
+    0xE0,0x00,0xE0,0x00,0xFF,0xE0,0xFF,0xF0,0x7F,0xF0,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x7F,0xF0,0x7F,0xF0,0x7F,0xE0,0x7F,0xE0,0xFF,0xE0,
+    0xFF,0xE0,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xE0,0x00,0xFF,0xE0,
+    0xFF,0xF0,0xFF,0xF0,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xFF,0xF0,0xFF,0xF0,0x7F,0xE0,0x7F,0xE0,0x7F,0xF0,0x7F,0xF0,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,
+    0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x00,
+    0x7F,0xE0,0xFF,0xF0,0xFF,0xF0,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xE0,0x70,0xFF,0xF0,0xFF,0xF0,0xFF,0xF0,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,
+    0xE0,0x70,0xE0,0x70,0xFF,0xF0,0xFF,0xF0,0x7F,0xE0,0x7F,0xE0,0xFF,0xF0,0xFF,0xF0,
+    0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xE0,0x70,0xFF,0xF0,0xFF,0xF0,
+    0x7F,0xF0,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x70,0x7F,0xF0,
+    0x7F,0xF0,0x7F,0xE0,0x00,0x00,0x00,0x00,0x00,0xE0,0xE0,0xE0,0x00,0x00,0x00,0x00,
+    0x00,0xE0,0xE0,0xE0,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const oledc_glyph_t fontLargeGlyphs[11] = {
+    {0,12}, {42,12}, {84,12}, {126,12}, {168,12}, {210,12},
+    {252,12}, {294,12}, {336,12}, {378,12}, {420,3},
+};
+
+const oledc_font_t oledC_fontLarge = {
+    21, 0x30, 0x3A, 2, 12, fontLargeGlyphs, fontLargeBits
+};
@@ -0,0 +1,176 @@
+/*
+ * File:   oledC_fonts.c
+ *
+ * Glyph rows are read straight from the packed tables; each run of set
+ * bits becomes one one-row rectangle, so glyphs go through whatever
+ * render target is active like every other primitive.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_fonts.h"
+#include "oledC_shapes.h"
+
+/* Widest slot streamed from the row buffer; wider ones are drawn as rectangles */
+#define OLEDC_SLOT_MAX_WIDTH 24
+
+static const oledc_glyph_t *findGlyph(const oledc_font_t *font, uint8_t ch);
+static void drawBitRow(const uint8_t *bits, uint8_t width, uint8_t x, uint8_t y, uint16_t color);
+
+static uint16_t slotRow[OLEDC_SLOT_MAX_WIDTH];
+
+static const oledc_glyph_t *findGlyph(const oledc_font_t *font, uint8_t ch)
+{
+    if(ch < font->first || ch > font->last)
+    {
+        return NULL;
+    }
+    return &font->glyphs[ch - font->first];
+}
+
+uint8_t oledC_fontAdvance(const oledc_font_t *font, uint8_t ch)
+{
+    const oledc_glyph_t *glyph = findGlyph(font, ch);
+    return glyph == NULL ? font->missing : glyph->width + font->spacing;
+}
+
+uint16_t oledC_fontStringWidth(const oledc_font_t *font, const uint8_t *string)
+{
+    uint16_t width = 0;
+    while(*string)
+    {
+        width += oledC_fontAdvance(font, *string++);
+    }
+    return width == 0 ? 0 : width - font->spacing;
+}
+
+static void drawBitRow(const uint8_t *bits, uint8_t width, uint8_t x, uint8_t y, uint16_t color)
+{
+    uint8_t i, start = 0;
+    bool inRun = false;
+
+    for(i = 0; i <= width; i++)
+    {
+        bool set = i < width && (bits[i >> 3] & (0x80 >> (i & 7)));
+        if(set && !inRun)
+        {
+            start = i;
+            inRun = true;
+        }
+        else if(!set && inRun)
+        {
+            oledC_DrawRectangle(x + start, y, x + i - 1, y, color);
+            inRun = false;
+        }
+    }
+}
+
+uint8_t oledC_fontDrawGlyph(const oledc_font_t *font, uint8_t x, uint8_t y, uint8_t ch, uint16_t color)
+{
+    const oledc_glyph_t *glyph = findGlyph(font, ch);
+    const uint8_t *bits;
+    uint8_t row, stride;
+
+    if(glyph == NULL)
+    {
+        return font->missing;
+    }
+    bits = &font->bits[glyph->offset];
+    stride = (glyph->width + 7) >> 3;
+    for(row = 0; row < font->height; row++, bits += stride)
+    {
+        drawBitRow(bits, glyph->width, x, y + row, color);
+    }
+    return glyph->width + font->spacing;
+}
+
+void oledC_fontDrawGlyphRow(const oledc_font_t *font, uint8_t x, uint8_t y, uint8_t ch, uint16_t color, uint8_t row)
+{
+    const oledc_glyph_t *glyph = findGlyph(font, ch);
+
+    if(glyph == NULL || row < y || row - y >= font->height)
+    {
+        return;
+    }
+    drawBitRow(&font->bits[glyph->offset + (row - y) * ((glyph->width + 7) >> 3)], glyph->width, x, row, color);
+}
+
+void oledC_slotInit(oledc_text_slot_t *slot, uint8_t x, uint8_t y, uint8_t width, const oledc_font_t *font, uint16_t color, uint16_t background)
+{
+    slot->x = x;
+    slot->y = y;
+    slot->width = width;
+    slot->font = font;
+    slot->color = color;
+    slot->background = background;
+    slot->shown = 0;
+}
+
+void oledC_slotInvalidate(oledc_text_slot_t *slot)
+{
+    slot->shown = 0;
+}
+
+/*
+ * The cell goes out as one window: pad, glyph bits and pad expanded into a
+ * row buffer per row. With a render target active, a cell too wide for
+ * the buffer or one clipped on the left or top, the background and glyph
+ * go through rectangles instead.
+ */
+bool oledC_slotUpdate(oledc_text_slot_t *slot, uint8_t ch)
+{
+    const oledc_font_t *font = slot->font;
+    const oledc_glyph_t *glyph;
+    const uint8_t *bits;
+    uint8_t row, i, pad, glyphWidth, stride, end_x, end_y;
+    oledc_rect_t window;
+
+    if(ch == slot->shown)
+    {
+        return false;
+    }
+    slot->shown = ch;
+    if(slot->x > 95 || slot->y > 95 || slot->width == 0)
+    {
+        return true;
+    }
+    glyph = findGlyph(font, ch);
+    glyphWidth = glyph == NULL ? 0 : (glyph->width > slot->width ? slot->width : glyph->width);
+    pad = (slot->width - glyphWidth) / 2;
+    end_x = (slot->x + slot->width - 1) > 95 ? 95 : (slot->x + slot->width - 1);
+    end_y = (slot->y + font->height - 1) > 95 ? 95 : (slot->y + font->height - 1);
+
+    if(oledC_getTarget() != NULL || slot->width > OLEDC_SLOT_MAX_WIDTH
+        || !oledC_clipWindow(slot->x, slot->y, slot->width, font->height, &window))
+    {
+        oledC_DrawRectangle(slot->x, slot->y, end_x, end_y, slot->background);
+        if(glyph != NULL)
+        {
+            oledC_fontDrawGlyph(font, slot->x + pad, slot->y, ch, slot->color);
+        }
+        return true;
+    }
+
+    oledC_beginWindow(window.xs, window.ys, window.xe, window.ye);
+    bits = glyph == NULL ? font->bits : &font->bits[glyph->offset];
+    stride = glyph == NULL ? 0 : (glyph->width + 7) >> 3;
+    for(row = window.ys; row <= window.ye; row++, bits += stride)
+    {
+        for(i = 0; i < slot->width; i++)
+        {
+            slotRow[i] = slot->background;
+        }
+        for(i = 0; i < glyphWidth; i++)
+        {
+            if(bits[i >> 3] & (0x80 >> (i & 7)))
+            {
+                slotRow[pad + i] = slot->color;
+            }
+        }
+        oledC_pushColors(slotRow, window.xe - window.xs + 1);
+    }
+    oledC_endWindow();
+    return true;
+}
@@ -0,0 +1,67 @@
+/*
+ * File:   oledC_fonts.h
+ *
+ * Pre-rasterised fonts in program memory. Each glyph is stored at its
+ * drawn size as packed bit rows, with its own width for proportional
+ * spacing, so drawing needs no scaling arithmetic.
+ */
+
+#ifndef OLEDC_FONTS_H
+#define	OLEDC_FONTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct oledc_glyph_t
+{
+    uint16_t offset;    /* first byte of the glyph in bits[] */
+    uint8_t width;      /* columns; each row takes (width + 7) / 8 bytes */
+} oledc_glyph_t;
+
+typedef struct oledc_font_t
+{
+    uint8_t height;     /* rows per glyph */
+    uint8_t first;      /* first character in glyphs[] */
+    uint8_t last;       /* last character in glyphs[] */
+    uint8_t spacing;    /* blank columns after every glyph */
+    uint8_t missing;    /* advance for characters outside first..last */
+    const oledc_glyph_t *glyphs;
+    const uint8_t *bits;    /* MSB = leftmost pixel */
+} oledc_font_t;
+
+/*
+ * One fixed-width character cell that remembers what it shows, so a
+ * display built from slots only repaints the characters that changed.
+ */
+typedef struct oledc_text_slot_t
+{
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;      /* cell columns; the glyph is centred in them */
+    uint8_t shown;      /* character on the panel, 0 = unknown */
+    const oledc_font_t *font;
+    uint16_t color;
+    uint16_t background;
+} oledc_text_slot_t;
+
+/* Generated by tools/mkfonts.py into oledC_fontData.c */
+extern const oledc_font_t oledC_fontSmall;     /* 5x7 proportional */
+extern const oledc_font_t oledC_fontMedium;    /* 10x14 proportional */
+extern const oledc_font_t oledC_fontLarge;     /* 12x21 numerals and ':' */
+
+/* Advance of ch: glyph width plus spacing */
+uint8_t oledC_fontAdvance(const oledc_font_t *font, uint8_t ch);
+uint16_t oledC_fontStringWidth(const oledc_font_t *font, const uint8_t *string);
+/* Glyph top-left at (x, y); returns the advance */
+uint8_t oledC_fontDrawGlyph(const oledc_font_t *font, uint8_t x, uint8_t y, uint8_t ch, uint16_t color);
+/* Only glyph row (row - y), for row-at-a-time renderers */
+void oledC_fontDrawGlyphRow(const oledc_font_t *font, uint8_t x, uint8_t y, uint8_t ch, uint16_t color, uint8_t row);
+
+
+void oledC_slotInit(oledc_text_slot_t *slot, uint8_t x, uint8_t y, uint8_t width, const oledc_font_t *font, uint16_t color, uint16_t background);
+/* Forget what the slot shows, e.g. after the screen was cleared */
+void oledC_slotInvalidate(oledc_text_slot_t *slot);
+/* Repaints the whole cell, background included, only if ch differs; returns true if it did */
+bool oledC_slotUpdate(oledc_text_slot_t *slot, uint8_t ch);
+
+#endif	/* OLEDC_FONTS_H */
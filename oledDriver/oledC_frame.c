@@ -0,0 +1,177 @@
+/*
+ * File:   oledC_frame.c
+ *
+ * Two pixels per byte, high nibble = left pixel, 48 bytes per row
+ * (4,608 bytes). A flush is always 96 * 96 pixels, one DMA row job per
+ * row, expanded through the palette while the previous row is sent.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_frame.h"
+
+#define FRAME_DIM 96
+#define FRAME_STRIDE (FRAME_DIM / 2)
+
+static uint8_t frameBuffer[FRAME_DIM * FRAME_STRIDE];
+static uint16_t palette[OLEDC_FRAME_PALETTE_SIZE] = 
+{
+    0x0000, /* black */
+    0xFFFF, /* white */
+    0xF800, /* red */
+    0x07E0, /* lime */
+    0x001F, /* blue */
+    0xFFE0, /* yellow */
+    0x07FF, /* cyan */
+    0xF81F, /* magenta */
+    0x8410, /* gray */
+    0xC618, /* silver */
+    0x4208, /* dark gray */
+    0xFD20, /* orange */
+    0x8800, /* dark red */
+    0x0400, /* green */
+    0x0010, /* navy */
+    0x8010  /* purple */
+};
+static uint16_t cachedColor = 0x0000;
+static uint8_t cachedIndex = 0;
+static uint8_t depth = 0;
+static const oledc_target_t *previousTarget = NULL;
+
+static void frameFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+static uint8_t colorToIndex(uint16_t color);
+
+static const oledc_target_t frameTarget = { frameFillRect };
+
+void oledC_frameSetPalette(uint8_t index, oledc_color_t color)
+{
+    if(index >= OLEDC_FRAME_PALETTE_SIZE)
+    {
+        return;
+    }
+    palette[index] = oledC_parseRGBToInt(color.red, color.green, color.blue);
+    cachedColor = palette[0];
+    cachedIndex = 0;
+}
+
+uint16_t oledC_frameGetPalette(uint8_t index)
+{
+    return index < OLEDC_FRAME_PALETTE_SIZE ? palette[index] : 0;
+}
+
+void oledC_frameClear(uint16_t color)
+{
+    uint8_t index = colorToIndex(color);
+    uint8_t packed = (index << 4) | index;
+    uint16_t i;
+    for(i = 0; i < sizeof(frameBuffer); i++)
+    {
+        frameBuffer[i] = packed;
+    }
+}
+
+void oledC_frameBegin(void)
+{
+    if(depth++ == 0)
+    {
+        previousTarget = oledC_setTarget(&frameTarget);
+    }
+}
+
+void oledC_frameEnd(void)
+{
+    if(depth == 0 || --depth > 0)
+    {
+        return;
+    }
+    oledC_frameFlush();
+    oledC_setTarget(previousTarget);
+}
+
+const oledc_target_t *oledC_frameTarget(void)
+{
+    return &frameTarget;
+}
+
+/* Exact palette hit first, otherwise the closest entry in 5-6-5 space */
+static uint8_t colorToIndex(uint16_t color)
+{
+    oledc_color_t want, have;
+    uint16_t bestDistance = 0xFFFF;
+    uint8_t i, best = 0;
+
+    if(color == cachedColor)
+    {
+        return cachedIndex;
+    }
+    want = oledC_parseIntToRGB(color);
+    for(i = 0; i < OLEDC_FRAME_PALETTE_SIZE; i++)
+    {
+        int16_t dr, dg, db;
+        uint16_t distance;
+        if(palette[i] == color)
+        {
+            best = i;
+            break;
+        }
+        have = oledC_parseIntToRGB(palette[i]);
+        dr = (int16_t)want.red - have.red;
+        dg = ((int16_t)want.green - have.green) / 2; /* green has one more bit */
+        db = (int16_t)want.blue - have.blue;
+        distance = dr * dr + dg * dg + db * db;
+        if(distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    cachedColor = color;
+    cachedIndex = best;
+    return best;
+}
+
+/* Rectangles arrive clipped to the panel by oledC_shapes.c */
+static void frameFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t index = colorToIndex(color);
+    uint8_t packed = (index << 4) | index;
+    uint8_t y, x;
+
+    for(y = start_y; y <= end_y; y++)
+    {
+        uint8_t *row = &frameBuffer[y * FRAME_STRIDE];
+        x = start_x;
+        if(x & 1)
+        {
+            row[x >> 1] = (row[x >> 1] & 0xF0) | index;
+            x++;
+        }
+        for(; x + 1 <= end_x; x += 2)
+        {
+            row[x >> 1] = packed;
+        }
+        if(x == end_x)
+        {
+            row[x >> 1] = (row[x >> 1] & 0x0F) | (index << 4);
+        }
+    }
+}
+
+void oledC_frameFlush(void)
+{
+    uint8_t x, y;
+
+    for(y = 0; y < FRAME_DIM; y++)
+    {
+        const uint8_t *row = &frameBuffer[y * FRAME_STRIDE];
+        uint16_t *pixels = oledC_rowBuffer();
+        for(x = 0; x < FRAME_STRIDE; x++)
+        {
+            pixels[2 * x] = palette[row[x] >> 4];
+            pixels[2 * x + 1] = palette[row[x] & 0x0F];
+        }
+        oledC_queueRowBuffer(0, y, FRAME_DIM - 1, y);
+    }
+}
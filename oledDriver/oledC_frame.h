@@ -0,0 +1,30 @@
+/*
+ * File:   oledC_frame.h
+ *
+ * Full-screen 4-bpp indexed framebuffer with a 16-entry RGB565 palette.
+ * Shapes drawn between oledC_frameBegin() and oledC_frameEnd() land in RAM;
+ * the End sends the whole frame by DMA, expanding through the palette.
+ * The buffer takes 4,608 bytes of RAM, so oledC_frame.c is left out of the
+ * default project; add it to a build that draws through the frame.
+ */
+
+#ifndef OLEDC_FRAME_H
+#define	OLEDC_FRAME_H
+
+#include <stdint.h>
+#include "oledC.h"
+#include "oledC_shapes.h"
+
+#define OLEDC_FRAME_PALETTE_SIZE 16
+
+/* Colours are looked up in the palette; unknown ones take the nearest entry */
+void oledC_frameSetPalette(uint8_t index, oledc_color_t color);
+uint16_t oledC_frameGetPalette(uint8_t index);
+void oledC_frameClear(uint16_t color);
+/* Nests; only the outermost End flushes and restores the previous target */
+void oledC_frameBegin(void);
+void oledC_frameEnd(void);
+void oledC_frameFlush(void);
+const oledc_target_t *oledC_frameTarget(void);
+
+#endif	/* OLEDC_FRAME_H */
@@ -0,0 +1,136 @@
+/*
+ * File:   oledC_image.c
+ *
+ * Decodes the run streams described in oledC_image.h. Without a render
+ * target every run becomes one repeated colour in a single window over
+ * the visible part of the image; with one, or with the top-left corner
+ * clipped away, each run is cut into one-row rectangles.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_image.h"
+#include "oledC_shapes.h"
+
+/* Where the next decoded pixel lands */
+typedef struct image_cursor_t
+{
+    uint8_t x;
+    uint8_t y;
+    uint8_t width;          /* image columns */
+    uint8_t visibleWidth;   /* columns that fit on the panel */
+    uint8_t visibleHeight;  /* rows that fit on the panel */
+    uint8_t col;
+    uint8_t row;
+    bool direct;            /* streaming into an open window */
+} image_cursor_t;
+
+static void emitRun(image_cursor_t *cursor, uint16_t color, uint16_t count);
+
+static void emitRun(image_cursor_t *cursor, uint16_t color, uint16_t count)
+{
+    uint16_t take, shown;
+
+    if(cursor->direct && cursor->col == 0 && cursor->visibleWidth == cursor->width)
+    {
+        /* Whole rows are visible, so a run over several rows is one push */
+        take = (uint16_t)(count / cursor->width);
+        shown = cursor->visibleHeight - cursor->row;
+        take = take < shown ? take : shown;
+        if(take > 0)
+        {
+            oledC_pushRepeat(color, take * cursor->width);
+            cursor->row += take;
+            count -= take * cursor->width;
+        }
+    }
+    while(count > 0 && cursor->row < cursor->visibleHeight)
+    {
+        take = cursor->width - cursor->col;
+        take = take < count ? take : count;
+        if(cursor->col < cursor->visibleWidth)
+        {
+            shown = cursor->visibleWidth - cursor->col;
+            shown = shown < take ? shown : take;
+            if(cursor->direct)
+            {
+                oledC_pushRepeat(color, shown);
+            }
+            else
+            {
+                oledC_DrawRectangle(cursor->x + cursor->col, cursor->y + cursor->row,
+                    cursor->x + cursor->col + shown - 1, cursor->y + cursor->row, color);
+            }
+        }
+        cursor->col += take;
+        count -= take;
+        if(cursor->col == cursor->width)
+        {
+            cursor->col = 0;
+            cursor->row++;
+        }
+    }
+}
+
+void oledC_DrawImage(uint8_t x, uint8_t y, const oledc_image_t *image)
+{
+    const uint8_t *data = image->data;
+    image_cursor_t cursor;
+    oledc_rect_t window;
+    uint16_t count, color;
+    uint8_t token;
+
+    if(x > OLED_DIM_WIDTH || y > OLED_DIM_HEIGHT || image->width == 0 || image->height == 0)
+    {
+        return;
+    }
+    cursor.x = x;
+    cursor.y = y;
+    cursor.width = image->width;
+    cursor.visibleWidth = image->width <= OLED_DIM_WIDTH - x + 1 ? image->width : OLED_DIM_WIDTH - x + 1;
+    cursor.visibleHeight = image->height <= OLED_DIM_HEIGHT - y + 1 ? image->height : OLED_DIM_HEIGHT - y + 1;
+    cursor.col = 0;
+    cursor.row = 0;
+    cursor.direct = oledC_getTarget() == NULL && oledC_clipWindow(x, y, image->width, image->height, &window);
+
+    if(cursor.direct)
+    {
+        cursor.visibleWidth = window.xe - window.xs + 1;
+        cursor.visibleHeight = window.ye - window.ys + 1;
+        oledC_beginWindow(window.xs, window.ys, window.xe, window.ye);
+    }
+    while(cursor.row < cursor.visibleHeight)
+    {
+        token = *data++;
+        if(image->format == OLEDC_IMAGE_RLE4)
+        {
+            count = token & 0x0F;
+            if(count == 0)
+            {
+                count = 16 + *data++;
+            }
+            emitRun(&cursor, image->palette[token >> 4], count);
+        }
+        else if(token & 0x80)
+        {
+            for(count = (token & 0x7F) + 1; count > 0; count--)
+            {
+                color = ((uint16_t)data[0] << 8) | data[1];
+                data += 2;
+                emitRun(&cursor, color, 1);
+            }
+        }
+        else
+        {
+            color = ((uint16_t)data[0] << 8) | data[1];
+            data += 2;
+            emitRun(&cursor, color, token + 1);
+        }
+    }
+    if(cursor.direct)
+    {
+        oledC_endWindow();
+    }
+}
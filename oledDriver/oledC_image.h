@@ -0,0 +1,41 @@
+/*
+ * File:   oledC_image.h
+ *
+ * Run-length compressed images in program memory, produced from PNG or
+ * PPM files by tools/mkimage.py. The decoder streams each run straight
+ * into the panel's write window, so no pixel buffer is needed.
+ *
+ * OLEDC_IMAGE_RLE4 (up to 16 colours), one byte per run:
+ *   high nibble  palette index
+ *   low nibble   run length 1..15; 0 = the next byte holds length - 16
+ *
+ * OLEDC_IMAGE_RLE565 (any colours), one control byte per packet:
+ *   0x00..0x7F   repeat: the next RGB565 colour, control + 1 times
+ *   0x80..0xFF   literal: (control & 0x7F) + 1 RGB565 colours follow
+ * RGB565 colours are stored high byte first. Runs carry on across rows.
+ */
+
+#ifndef OLEDC_IMAGE_H
+#define	OLEDC_IMAGE_H
+
+#include <stdint.h>
+
+enum OLEDC_IMAGE_FORMAT
+{
+    OLEDC_IMAGE_RLE4,
+    OLEDC_IMAGE_RLE565,
+};
+
+typedef struct oledc_image_t
+{
+    uint8_t width;
+    uint8_t height;
+    uint8_t format;             /* enum OLEDC_IMAGE_FORMAT */
+    const uint16_t *palette;    /* RLE4 only */
+    const uint8_t *data;
+} oledc_image_t;
+
+/* Top-left at (x, y); the part past the panel edge is skipped */
+void oledC_DrawImage(uint8_t x, uint8_t y, const oledc_image_t *image);
+
+#endif	/* OLEDC_IMAGE_H */
@@ -0,0 +1,124 @@
+/*
+ * File:   oledC_scanline.c
+ *
+ * For every row of the region the line buffer is filled with background,
+ * each shape whose bounds cover the row draws just that row into it, and
+ * the row is pushed into an already open window. Shapes draw through the
+ * normal primitives with the line buffer set as their target.
+ *
+ * The line buffer is a row inside one of the driver's DMA row buffers.
+ * Once a buffer holds as many rows as fit, it is queued as a window of its
+ * own and the next rows are rendered while it is sent.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_scanline.h"
+
+#define SCANLINE_DIM 96
+
+static uint16_t *lineBuffer; /* lineBuffer[0] is column lineStart */
+static uint8_t lineRow;
+static uint8_t lineStart;
+static uint8_t lineEnd;
+static oledc_rect_t bounds[OLEDC_SCANLINE_MAX_SHAPES];
+static bool visible[OLEDC_SCANLINE_MAX_SHAPES];
+static shape_t *listed[OLEDC_SCANLINE_MAX_SHAPES];
+
+static void lineFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+static const oledc_target_t lineTarget = { lineFillRect };
+
+void oledC_scanlineRender(const oledc_rect_t *region, shape_t *shapes, uint8_t count, uint16_t background)
+{
+    uint8_t i;
+
+    if(count > OLEDC_SCANLINE_MAX_SHAPES)
+    {
+        count = OLEDC_SCANLINE_MAX_SHAPES;
+    }
+    for(i = 0; i < count; i++)
+    {
+        listed[i] = &shapes[i];
+    }
+    oledC_scanlineRenderList(region, listed, count, background);
+}
+
+void oledC_scanlineRenderList(const oledc_rect_t *region, shape_t *const *shapes, uint8_t count, uint16_t background)
+{
+    const oledc_target_t *previous;
+    oledc_rect_t area = {0, 0, SCANLINE_DIM - 1, SCANLINE_DIM - 1};
+    uint8_t i, x, width, bandRows, bandStart = 0;
+    uint16_t *band = NULL;
+
+    if(region != NULL)
+    {
+        area = *region;
+        area.xe = area.xe >= SCANLINE_DIM ? SCANLINE_DIM - 1 : area.xe;
+        area.ye = area.ye >= SCANLINE_DIM ? SCANLINE_DIM - 1 : area.ye;
+        if(area.xs > area.xe || area.ys > area.ye)
+        {
+            return;
+        }
+    }
+    if(count > OLEDC_SCANLINE_MAX_SHAPES)
+    {
+        count = OLEDC_SCANLINE_MAX_SHAPES;
+    }
+    for(i = 0; i < count; i++)
+    {
+        visible[i] = shapes[i]->active && oledC_getShapeBounds(shapes[i], &bounds[i])
+            && bounds[i].xs <= area.xe && bounds[i].xe >= area.xs
+            && bounds[i].ys <= area.ye && bounds[i].ye >= area.ys;
+    }
+
+    lineStart = area.xs;
+    lineEnd = area.xe;
+    width = area.xe - area.xs + 1;
+    bandRows = OLEDC_ROW_BUFFER_PIXELS / width;
+    previous = oledC_setTarget(&lineTarget);
+    for(lineRow = area.ys; lineRow <= area.ye; lineRow++)
+    {
+        if(band == NULL)
+        {
+            band = oledC_rowBuffer();
+            bandStart = lineRow;
+        }
+        lineBuffer = &band[(uint16_t)(lineRow - bandStart) * width];
+        for(x = 0; x < width; x++)
+        {
+            lineBuffer[x] = background;
+        }
+        for(i = 0; i < count; i++)
+        {
+            if(visible[i] && lineRow >= bounds[i].ys && lineRow <= bounds[i].ye)
+            {
+                oledC_drawShapeRow(shapes[i], lineRow);
+            }
+        }
+        if(lineRow == area.ye || lineRow - bandStart + 1 == bandRows)
+        {
+            oledC_queueRowBuffer(area.xs, bandStart, area.xe, lineRow);
+            band = NULL;
+        }
+    }
+    oledC_setTarget(previous);
+}
+
+static void lineFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t x;
+
+    if(lineRow < start_y || lineRow > end_y)
+    {
+        return;
+    }
+    start_x = start_x < lineStart ? lineStart : start_x;
+    end_x = end_x > lineEnd ? lineEnd : end_x;
+    for(x = start_x; x <= end_x; x++)
+    {
+        lineBuffer[x - lineStart] = color;
+    }
+}
@@ -0,0 +1,26 @@
+/*
+ * File:   oledC_scanline.h
+ *
+ * Renders a list of shapes one panel row at a time into a line buffer, so
+ * a whole screen (or region) goes out as DMA row bands with every pixel
+ * written exactly once.
+ */
+
+#ifndef OLEDC_SCANLINE_H
+#define	OLEDC_SCANLINE_H
+
+#include <stdint.h>
+#include "oledC_shapes.h"
+
+/* Shapes past this index are ignored */
+#define OLEDC_SCANLINE_MAX_SHAPES 32
+
+/*
+ * Paints region (NULL = whole panel) with background, then the shapes in
+ * list order on top. Inactive shapes are skipped.
+ */
+void oledC_scanlineRender(const oledc_rect_t *region, shape_t *shapes, uint8_t count, uint16_t background);
+/* The same for shapes that do not sit in one array, bottom first */
+void oledC_scanlineRenderList(const oledc_rect_t *region, shape_t *const *shapes, uint8_t count, uint16_t background);
+
+#endif	/* OLEDC_SCANLINE_H */
@@ -0,0 +1,258 @@
+/*
+ * File:   oledC_shadow.c
+ *
+ * Two 1-bpp planes (1 = foreground), MSB = leftmost, 12 bytes per row:
+ * shadowBits is what has been drawn, panelBits what the panel shows. Each
+ * row keeps the span touched since the last flush; the flush narrows it to
+ * the bits that really differ, merges overlapping spans of neighbouring
+ * rows into rectangles and sends each one by DMA, in bands of rows that
+ * fit a driver row buffer. The flush returns while the last bands are
+ * still going out.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC.h"
+#include "oledC_shadow.h"
+
+#define SHADOW_DIM 96
+#define SHADOW_STRIDE (SHADOW_DIM / 8)
+#define SHADOW_CLEAN 0xFF
+
+static uint8_t shadowBits[SHADOW_DIM * SHADOW_STRIDE];
+static uint8_t panelBits[SHADOW_DIM * SHADOW_STRIDE];
+static uint8_t dirtyStart[SHADOW_DIM];
+static uint8_t dirtyEnd[SHADOW_DIM];
+static uint16_t foregroundColor = 0xFFFF;
+static uint16_t backgroundColor = 0x0000;
+static uint8_t depth = 0;
+static bool touched = false;     /* any row marked since the last flush */
+static const oledc_target_t *previousTarget = NULL;
+static oledc_shadow_stats_t lastStats;
+
+static void shadowFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+static void markTouched(uint8_t y, uint8_t start_x, uint8_t end_x);
+static bool settleRow(uint8_t y);
+static void sendRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+
+static const oledc_target_t shadowTarget = { shadowFillRect };
+
+void oledC_shadowReset(uint16_t foreground, uint16_t background)
+{
+    uint16_t i;
+    foregroundColor = foreground;
+    backgroundColor = background;
+    for(i = 0; i < sizeof(shadowBits); i++)
+    {
+        shadowBits[i] = 0;
+        panelBits[i] = 0;
+    }
+    for(i = 0; i < SHADOW_DIM; i++)
+    {
+        dirtyStart[i] = SHADOW_CLEAN;
+    }
+    touched = false;
+}
+
+void oledC_shadowBegin(void)
+{
+    if(depth++ == 0)
+    {
+        previousTarget = oledC_setTarget(&shadowTarget);
+    }
+}
+
+void oledC_shadowEnd(void)
+{
+    if(depth == 0 || --depth > 0)
+    {
+        return;
+    }
+    oledC_shadowFlush();
+    oledC_setTarget(previousTarget);
+}
+
+const oledc_target_t *oledC_shadowTarget(void)
+{
+    return &shadowTarget;
+}
+
+void oledC_shadowGetStats(oledc_shadow_stats_t *stats)
+{
+    *stats = lastStats;
+}
+
+/* Rectangles arrive clipped to the panel by oledC_shapes.c */
+static void shadowFillRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    bool set = (color != backgroundColor);
+    uint8_t firstByte = start_x >> 3;
+    uint8_t lastByte = end_x >> 3;
+    uint8_t firstMask = 0xFF >> (start_x & 7);
+    uint8_t lastMask = 0xFF << (7 - (end_x & 7));
+    uint8_t y, b;
+
+    for(y = start_y; y <= end_y; y++)
+    {
+        uint8_t *row = &shadowBits[y * SHADOW_STRIDE];
+        for(b = firstByte; b <= lastByte; b++)
+        {
+            uint8_t mask = 0xFF;
+            if(b == firstByte)
+            {
+                mask &= firstMask;
+            }
+            if(b == lastByte)
+            {
+                mask &= lastMask;
+            }
+            row[b] = set ? (row[b] | mask) : (row[b] & ~mask);
+        }
+        markTouched(y, start_x, end_x);
+    }
+}
+
+static void markTouched(uint8_t y, uint8_t start_x, uint8_t end_x)
+{
+    touched = true;
+    if(dirtyStart[y] == SHADOW_CLEAN)
+    {
+        dirtyStart[y] = start_x;
+        dirtyEnd[y] = end_x;
+        return;
+    }
+    if(start_x < dirtyStart[y])
+    {
+        dirtyStart[y] = start_x;
+    }
+    if(end_x > dirtyEnd[y])
+    {
+        dirtyEnd[y] = end_x;
+    }
+}
+
+/*
+ * Narrows a touched row to the bits that differ from the panel and marks
+ * them as sent. Returns false when drawing left the row as it was.
+ */
+static bool settleRow(uint8_t y)
+{
+    uint8_t *drawn = &shadowBits[y * SHADOW_STRIDE];
+    uint8_t *shown = &panelBits[y * SHADOW_STRIDE];
+    uint8_t firstByte = dirtyStart[y] >> 3;
+    uint8_t lastByte = dirtyEnd[y] >> 3;
+    uint8_t first = SHADOW_CLEAN, last = 0;
+    uint8_t b, bits;
+
+    for(b = firstByte; b <= lastByte; b++)
+    {
+        uint8_t changed = drawn[b] ^ shown[b];
+        if(changed == 0)
+        {
+            continue;
+        }
+        if(first == SHADOW_CLEAN)
+        {
+            first = b << 3;
+            for(bits = changed; !(bits & 0x80); bits <<= 1)
+            {
+                first++;
+            }
+        }
+        last = (b << 3) + 7;
+        for(bits = changed; !(bits & 0x01); bits >>= 1)
+        {
+            last--;
+        }
+        shown[b] = drawn[b];
+    }
+    dirtyStart[y] = first;
+    dirtyEnd[y] = last;
+    return first != SHADOW_CLEAN;
+}
+
+/*
+ * The rectangle goes out as bands of whole rows, as many as fit one row
+ * buffer, each a DMA job of its own; the CPU expands the next band while
+ * the previous one is sent.
+ */
+static void sendRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    uint8_t x, y, bandStart, bandEnd;
+    uint16_t width = end_x - start_x + 1;
+    uint8_t bandRows = OLEDC_ROW_BUFFER_PIXELS / width;
+
+    for(bandStart = start_y; bandStart <= end_y; bandStart = bandEnd + 1)
+    {
+        uint16_t *pixels = oledC_rowBuffer();
+        bandEnd = end_y - bandStart < bandRows ? end_y : bandStart + bandRows - 1;
+        for(y = bandStart; y <= bandEnd; y++)
+        {
+            const uint8_t *row = &shadowBits[y * SHADOW_STRIDE];
+            for(x = start_x; x <= end_x; x++)
+            {
+                *pixels++ = (row[x >> 3] & (0x80 >> (x & 7))) ? foregroundColor : backgroundColor;
+            }
+        }
+        oledC_queueRowBuffer(start_x, bandStart, end_x, bandEnd);
+    }
+    lastStats.rects++;
+    lastStats.pixels += width * (end_y - start_y + 1);
+}
+
+/*
+ * Rows are merged while their spans overlap or touch; the few unchanged
+ * pixels this pulls in are re-sent as they are, which is cheaper than
+ * another window.
+ */
+void oledC_shadowFlush(void)
+{
+    uint8_t y;
+    uint8_t rectStartY = 0, rectStartX = 0, rectEndX = 0;
+    bool open = false;
+
+    lastStats.rects = 0;
+    lastStats.pixels = 0;
+    if(!touched)
+    {
+        return;
+    }
+    touched = false;
+    for(y = 0; y < SHADOW_DIM; y++)
+    {
+        uint8_t s, e;
+        if(dirtyStart[y] != SHADOW_CLEAN)
+        {
+            settleRow(y);
+        }
+        s = dirtyStart[y];
+        e = dirtyEnd[y];
+        if(open && (s == SHADOW_CLEAN || s > rectEndX + 1 || e + 1 < rectStartX))
+        {
+            sendRect(rectStartX, rectStartY, rectEndX, y - 1);
+            open = false;
+        }
+        if(s == SHADOW_CLEAN)
+        {
+            continue;
+        }
+        if(!open)
+        {
+            rectStartY = y;
+            rectStartX = s;
+            rectEndX = e;
+            open = true;
+        }
+        else
+        {
+            rectStartX = s < rectStartX ? s : rectStartX;
+            rectEndX = e > rectEndX ? e : rectEndX;
+        }
+        dirtyStart[y] = SHADOW_CLEAN;
+    }
+    if(open)
+    {
+        sendRect(rectStartX, rectStartY, rectEndX, SHADOW_DIM - 1);
+    }
+}
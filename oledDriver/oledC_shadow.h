@@ -0,0 +1,29 @@
+/*
+ * File:   oledC_shadow.h
+ *
+ * 1-bpp shadow of the 96x96 panel. Shapes drawn while the shadow is the
+ * target only touch RAM; oledC_shadowEnd() sends the pixels that changed.
+ */
+
+#ifndef OLEDC_SHADOW_H
+#define	OLEDC_SHADOW_H
+
+#include <stdint.h>
+#include "oledC_shapes.h"
+
+typedef struct oledc_shadow_stats_t
+{
+    uint16_t rects;     /* windows opened by the last flush */
+    uint16_t pixels;    /* pixels sent by the last flush */
+} oledc_shadow_stats_t;
+
+/* The panel was just cleared to background; any other colour draws as foreground */
+void oledC_shadowReset(uint16_t foreground, uint16_t background);
+/* Nests; only the outermost End flushes and restores the previous target */
+void oledC_shadowBegin(void);
+void oledC_shadowEnd(void);
+void oledC_shadowFlush(void);
+void oledC_shadowGetStats(oledc_shadow_stats_t *stats);
+const oledc_target_t *oledC_shadowTarget(void);
+
+#endif	/* OLEDC_SHADOW_H */
@@ -22,107 +22,339 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include "oledC.h"
 #include "oledC_shapeHandler.h"
 #include "oledC_shapes.h"
+#include "oledC_scanline.h"
 
 #define MAX_NUMBER_OF_SHAPES 32
-
-static void dummyshape(shape_t *shape)
-{
-}
+#define NO_SHAPE 0xFF
+/*
+ * Two damaged rectangles are merged when their union covers at most this
+ * many pixels that neither of them needs. Each separate repair costs a
+ * window setup and a pass over the shape list, worth about this much.
+ */
+#define DAMAGE_MERGE_SLACK 16
 
 static shape_t allParsedShapes[MAX_NUMBER_OF_SHAPES];
+static uint8_t generation[MAX_NUMBER_OF_SHAPES];
+static uint8_t bottomShape = NO_SHAPE;
+static uint8_t topShape = NO_SHAPE;
+static uint8_t freeShape = NO_SHAPE;    /* free slots, chained through above */
+static bool shapesReady = false;
 
-void initShapesMem(void)
+static oledc_rect_t damage[OLEDC_MAX_DAMAGE];
+static uint8_t damageCount = 0;
+static shape_t *repairList[MAX_NUMBER_OF_SHAPES];
+
+static void initShapesMem(void);
+static shape_t *findShape(oledc_shape_handle_t handle);
+static void cacheBounds(shape_t *shape);
+static uint16_t rectArea(const oledc_rect_t *rect);
+static void rectUnion(const oledc_rect_t *a, const oledc_rect_t *b, oledc_rect_t *result);
+static uint16_t mergeWaste(const oledc_rect_t *a, const oledc_rect_t *b);
+static void addDamage(oledc_rect_t rect);
+static bool overlaps(const shape_t *shape, const oledc_rect_t *region);
+static void renderRegion(const oledc_rect_t *region);
+
+static void initShapesMem(void)
 {
     uint8_t i;
     for(i = 0; i < MAX_NUMBER_OF_SHAPES; i++)
     {
         allParsedShapes[i].active = false;
-        allParsedShapes[i].draw = dummyshape;
+        allParsedShapes[i].above = i + 1 < MAX_NUMBER_OF_SHAPES ? i + 1 : NO_SHAPE;
+        generation[i] = 1;
     }
+    freeShape = 0;
+    shapesReady = true;
 }
 
-void oledC_removeShape(uint8_t drawIndex)
+static shape_t *findShape(oledc_shape_handle_t handle)
 {
-    uint8_t i;
-    for(i = drawIndex; i < (MAX_NUMBER_OF_SHAPES - 1); i++)
+    uint8_t slot = handle & 0xFF;
+    if(slot >= MAX_NUMBER_OF_SHAPES || !allParsedShapes[slot].active || generation[slot] != (handle >> 8))
     {
-        allParsedShapes[i] = allParsedShapes[i+1];
+        return NULL;
     }
-    allParsedShapes[MAX_NUMBER_OF_SHAPES-1].active = false;
+    return &allParsedShapes[slot];
 }
 
-shape_t* oledC_getShape(uint8_t index)
+static void cacheBounds(shape_t *shape)
 {
-    index = index > MAX_NUMBER_OF_SHAPES ? MAX_NUMBER_OF_SHAPES : index;
-    return &allParsedShapes[index];
+    shape->onScreen = oledC_getShapeBounds(shape, &shape->bounds);
 }
 
-void oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params)
+oledc_shape_handle_t oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params)
 {
-    uint8_t i;
+    uint8_t slot, next = bottomShape;
     shape_t *newShape;
-    drawIndex = drawIndex >= MAX_NUMBER_OF_SHAPES ? (MAX_NUMBER_OF_SHAPES-1) : drawIndex;
-    for(i = (MAX_NUMBER_OF_SHAPES-1); i > drawIndex && i > 0; i--)
+
+    if(!shapesReady)
+    {
+        initShapesMem();
+    }
+    if(freeShape == NO_SHAPE)
     {
-        allParsedShapes[i] = allParsedShapes[i-1];
-    }   
-    
-    newShape = &allParsedShapes[drawIndex];
+        return OLEDC_SHAPE_HANDLE_NONE;
+    }
+    slot = freeShape;
+    newShape = &allParsedShapes[slot];
+    freeShape = newShape->above;
+
     oledC_createShape(shape_type, params, newShape);
+    newShape->hidden = false;
+    cacheBounds(newShape);
+
+    /* Link in below the shape now at drawIndex, or on top */
+    while(drawIndex-- > 0 && next != NO_SHAPE)
+    {
+        next = allParsedShapes[next].above;
+    }
+    newShape->above = next;
+    newShape->below = next == NO_SHAPE ? topShape : allParsedShapes[next].below;
+    if(newShape->below == NO_SHAPE)
+    {
+        bottomShape = slot;
+    }
+    else
+    {
+        allParsedShapes[newShape->below].above = slot;
+    }
+    if(next == NO_SHAPE)
+    {
+        topShape = slot;
+    }
+    else
+    {
+        allParsedShapes[next].below = slot;
+    }
+    return ((uint16_t)generation[slot] << 8) | slot;
+}
+
+void oledC_removeShape(oledc_shape_handle_t handle)
+{
+    shape_t *shape = findShape(handle);
+    uint8_t slot = handle & 0xFF;
+    if(shape == NULL)
+    {
+        return;
+    }
+    if(!shape->hidden && shape->onScreen)
+    {
+        addDamage(shape->bounds);
+    }
+    if(shape->below == NO_SHAPE)
+    {
+        bottomShape = shape->above;
+    }
+    else
+    {
+        allParsedShapes[shape->below].above = shape->above;
+    }
+    if(shape->above == NO_SHAPE)
+    {
+        topShape = shape->below;
+    }
+    else
+    {
+        allParsedShapes[shape->above].below = shape->below;
+    }
+    shape->active = false;
+    generation[slot] = generation[slot] == 0xFF ? 1 : generation[slot] + 1;
+    shape->above = freeShape;
+    freeShape = slot;
 }
 
-void oledC_redrawIndex(uint8_t indShape)
+shape_t* oledC_getShape(oledc_shape_handle_t handle)
 {
-    allParsedShapes[indShape].draw(&allParsedShapes[indShape]);
+    return findShape(handle);
 }
 
-void oledC_redrawTo(uint8_t endInd)
+void oledC_shapeChanged(oledc_shape_handle_t handle)
 {
-    oledC_redrawSome(0,endInd);
+    shape_t *shape = findShape(handle);
+    if(shape == NULL)
+    {
+        return;
+    }
+    if(!shape->hidden && shape->onScreen)
+    {
+        addDamage(shape->bounds);
+    }
+    cacheBounds(shape);
+    if(!shape->hidden && shape->onScreen)
+    {
+        addDamage(shape->bounds);
+    }
 }
 
-void oledC_redrawFrom(uint8_t startInd)
+void oledC_redrawShape(oledc_shape_handle_t handle)
 {
-    oledC_redrawSome(startInd, MAX_NUMBER_OF_SHAPES);
+    shape_t *shape = findShape(handle);
+    if(shape != NULL)
+    {
+        shape->hidden = false;
+        shape->draw(shape);
+    }
 }
 
-void oledC_redrawSome(uint8_t startInd, uint8_t endInd)
+void oledC_redrawAll(void)
 {
     uint8_t i;
-    endInd = endInd > MAX_NUMBER_OF_SHAPES ? MAX_NUMBER_OF_SHAPES : endInd;
-    for(i = startInd; i < endInd; i++)
+    for(i = bottomShape; i != NO_SHAPE; i = allParsedShapes[i].above)
     {
-        if(allParsedShapes[i].active)
+        if(!allParsedShapes[i].hidden)
         {
             allParsedShapes[i].draw(&allParsedShapes[i]);
         }
     }
 }
 
-void oledC_eraseShape(uint8_t indShape,uint16_t eraseColor)
+static bool overlaps(const shape_t *shape, const oledc_rect_t *region)
+{
+    return !shape->hidden && shape->onScreen && shape->bounds.xs <= region->xe && shape->bounds.xe >= region->xs
+        && shape->bounds.ys <= region->ye && shape->bounds.ye >= region->ys;
+}
+
+/* Renders a panel rectangle from the background and the shapes over it */
+static void renderRegion(const oledc_rect_t *region)
+{
+    uint8_t i, count = 0;
+    shape_t *shape;
+
+    for(i = bottomShape; i != NO_SHAPE; i = shape->above)
+    {
+        shape = &allParsedShapes[i];
+        if(overlaps(shape, region))
+        {
+            repairList[count++] = shape;
+        }
+    }
+    oledC_scanlineRenderList(region, repairList, count, oledC_getBackground());
+}
+
+bool oledC_redrawRegion(const oledc_rect_t *region)
 {
-    shape_t* ourShape = oledC_getShape(indShape);
-    uint16_t saveColor = ourShape->params.point.color;
-    ourShape->params.point.color = eraseColor;
-    ourShape->draw(ourShape);
-    ourShape->params.point.color = saveColor;
+    /* region is in panel coordinates, which a pushed clip would shift */
+    if(oledC_clipDepth() != 0)
+    {
+        return false;
+    }
+    renderRegion(region);
+    return true;
 }
 
-void oledC_eraseAll(uint16_t eraseColor)
+void oledC_eraseShape(oledc_shape_handle_t handle)
+{
+    shape_t *shape = findShape(handle);
+    if(shape == NULL || shape->hidden)
+    {
+        return;
+    }
+    shape->hidden = true;
+    if(shape->onScreen)
+    {
+        addDamage(shape->bounds);
+    }
+}
+
+void oledC_eraseAll(void)
 {
     uint8_t i;
-    for(i = 0; i < MAX_NUMBER_OF_SHAPES; i++)
+    for(i = bottomShape; i != NO_SHAPE; i = allParsedShapes[i].above)
+    {
+        oledC_eraseShape(((uint16_t)generation[i] << 8) | i);
+    }
+}
+
+static uint16_t rectArea(const oledc_rect_t *rect)
+{
+    return (uint16_t)(rect->xe - rect->xs + 1) * (rect->ye - rect->ys + 1);
+}
+
+static void rectUnion(const oledc_rect_t *a, const oledc_rect_t *b, oledc_rect_t *result)
+{
+    result->xs = a->xs < b->xs ? a->xs : b->xs;
+    result->ys = a->ys < b->ys ? a->ys : b->ys;
+    result->xe = a->xe > b->xe ? a->xe : b->xe;
+    result->ye = a->ye > b->ye ? a->ye : b->ye;
+}
+
+/* Pixels the union of a and b covers that neither of them does */
+static uint16_t mergeWaste(const oledc_rect_t *a, const oledc_rect_t *b)
+{
+    oledc_rect_t joined;
+    uint16_t covered = rectArea(a) + rectArea(b);
+    uint8_t xs = a->xs > b->xs ? a->xs : b->xs;
+    uint8_t ys = a->ys > b->ys ? a->ys : b->ys;
+    uint8_t xe = a->xe < b->xe ? a->xe : b->xe;
+    uint8_t ye = a->ye < b->ye ? a->ye : b->ye;
+
+    if(xs <= xe && ys <= ye)
+    {
+        covered -= (uint16_t)(xe - xs + 1) * (ye - ys + 1);
+    }
+    rectUnion(a, b, &joined);
+    return rectArea(&joined) - covered;
+}
+
+/*
+ * Merges rect into the list while that is cheap, and keeps merging the
+ * result into the rest until nothing else qualifies. A full list takes
+ * the merge that wastes least.
+ */
+static void addDamage(oledc_rect_t rect)
+{
+    uint8_t i, best;
+    uint16_t waste, bestWaste;
+
+    rect.xe = rect.xe > OLED_DIM_WIDTH ? OLED_DIM_WIDTH : rect.xe;
+    rect.ye = rect.ye > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : rect.ye;
+    if(rect.xs > rect.xe || rect.ys > rect.ye)
     {
-        if(allParsedShapes[i].active)
+        return;
+    }
+    for(;;)
+    {
+        best = NO_SHAPE;
+        bestWaste = 0xFFFF;
+        for(i = 0; i < damageCount; i++)
+        {
+            waste = mergeWaste(&damage[i], &rect);
+            if(waste < bestWaste)
+            {
+                best = i;
+                bestWaste = waste;
+            }
+        }
+        if(best == NO_SHAPE || (bestWaste > DAMAGE_MERGE_SLACK && damageCount < OLEDC_MAX_DAMAGE))
         {
-            oledC_eraseShape(i,eraseColor);
+            damage[damageCount++] = rect;
+            return;
         }
+        rectUnion(&damage[best], &rect, &rect);
+        damage[best] = damage[--damageCount];
     }
 }
 
-void oledC_redrawAll(void)
+void oledC_damageRegion(const oledc_rect_t *region)
+{
+    addDamage(*region);
+}
+
+bool oledC_repairDamage(void)
 {
-    oledC_redrawSome(0,MAX_NUMBER_OF_SHAPES);
+    /* damage is in panel coordinates too */
+    if(oledC_clipDepth() != 0)
+    {
+        return false;
+    }
+    while(damageCount > 0)
+    {
+        damageCount--;
+        renderRegion(&damage[damageCount]);
+    }
+    return true;
 }
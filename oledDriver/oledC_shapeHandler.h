@@ -26,16 +26,54 @@
 #include <stdint.h>
 #include "oledC_shapes.h"
 
+/*
+ * Shapes are kept in a pool and drawn bottom to top along a z-order list.
+ * A handle names one pool slot and the generation it was handed out in,
+ * so it stays valid while other shapes come and go and goes stale once
+ * its own shape is removed.
+ */
+typedef uint16_t oledc_shape_handle_t;
+#define OLEDC_SHAPE_HANDLE_NONE 0
+
+/*
+ * Erasing, moving or damaging does not touch the panel straight away: the
+ * affected rectangles are collected, merged where that is cheaper than
+ * repairing them apart, and oledC_repairDamage() re-renders each one from
+ * the background and the shapes that overlap it, every pixel once.
+ */
+#define OLEDC_MAX_DAMAGE 6
+
+/* Inserts at z-position drawIndex (0 = bottom, past the end = top) */
+oledc_shape_handle_t oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params);
+/* Damages what the shape covered */
+void oledC_removeShape(oledc_shape_handle_t handle);
+/* NULL for a stale handle */
+shape_t* oledC_getShape(oledc_shape_handle_t handle);
+/*
+ * Call after changing a shape's params in place: refreshes its cached
+ * bounds and damages both the old and the new ones
+ */
+void oledC_shapeChanged(oledc_shape_handle_t handle);
+/* Draws the shape on top as it stands, showing it again if erased */
+void oledC_redrawShape(oledc_shape_handle_t handle);
+/* Draws every shape that is not erased */
 void oledC_redrawAll(void);
-void oledC_redrawTo(uint8_t endInd);
-void oledC_redrawSome(uint8_t startInd, uint8_t endInd);
-void oledC_redrawFrom(uint8_t startInd);
-void oledC_redrawIndex(uint8_t indShape);
-void oledC_addShape(uint8_t drawIndex, enum OLEDC_SHAPE shape_type, shape_params_t *params);
-void oledC_removeShape(uint8_t drawIndex);
-void oledC_eraseShape(uint8_t indShape, uint16_t eraseColor);
-void oledC_eraseAll(uint16_t eraseColor);
-shape_t* oledC_getShape(uint8_t index);
+/*
+ * Repaints region (panel coordinates) from oledC_getBackground() and the
+ * shapes over it, every pixel once. False, drawing nothing, while a clip
+ * or viewport is pushed.
+ */
+bool oledC_redrawRegion(const oledc_rect_t *region);
+/* Hides the shape and damages what it covered */
+void oledC_eraseShape(oledc_shape_handle_t handle);
+void oledC_eraseAll(void);
+void oledC_damageRegion(const oledc_rect_t *region);
+/*
+ * Restores every damaged rectangle with oledC_getBackground() under the
+ * shapes. False, keeping the damage for later, while a clip or viewport
+ * is pushed.
+ */
+bool oledC_repairDamage(void);
 
 #endif	/* OLEDC_SHAPE_HANDLER_H */
 
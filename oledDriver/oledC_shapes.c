@@ -22,24 +22,150 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
+#include <string.h>
 #include "oledC_shapes.h"
 #include "oledC.h"
 
-static const uint8_t OLED_DIM_WIDTH = 0x5F;
-static const uint8_t OLED_DIM_HEIGHT = 0x5F;
 static const uint8_t OLED_FONT_WIDTH = 0x5;
 static const uint8_t OLED_FONT_HEIGHT = 0x8;
+/* Widest scale the opaque text row buffer holds; larger ones go through rectangles */
+#define OLED_TEXT_MAX_SCALE 4
+/* Smaller fills cost less than a DMA job and its interrupt */
+static const uint16_t OLED_DMA_FILL_MIN = 64;
+
+/* NULL: primitives go straight to the panel */
+static const oledc_target_t *target = NULL;
+
+/* A clip rectangle in panel coordinates and the origin of local ones */
+typedef struct clip_frame_t
+{
+    oledc_rect_t rect;      /* empty when xs > xe */
+    int16_t x;
+    int16_t y;
+} clip_frame_t;
+
+static clip_frame_t clipStack[OLEDC_CLIP_DEPTH + 1] = {{{0, 0, 95, 95}, 0, 0}};
+static uint8_t clipDepth = 0;
 
 static void drawPoint(shape_t *shape);
 static void drawCircle(shape_t *shape);
 static void drawRing(shape_t *shape);
+static void drawArc(shape_t *shape);
+static void drawPackedBitmap(shape_t *shape);
+static void fillArc(int16_t x0, int16_t y0, int16_t outer, int16_t inner,
+    uint16_t start, uint16_t end, int16_t row, uint16_t color);
+static int16_t legacyBitmapX(uint8_t x, uint8_t sx);
+static void drawBitmapSpans(int16_t x, int16_t ys, int16_t ye, uint32_t bits, uint8_t width,
+    uint8_t sx, uint16_t color, uint16_t background, bool transparent);
 static void drawRectangle(shape_t *shape);
 static void drawLine(shape_t *shape);
 static void drawCharacter(shape_t *shape);
 static void drawString(shape_t *shape);
 //static void drawString(shape_t *shape);
 static void drawBitmap(shape_t *shape);
+static void drawPoints(shape_t *shape);
+static void drawPolyline(shape_t *shape);
+static void drawPointRun(uint8_t x, uint8_t y, uint16_t length, uint16_t color);
+static uint16_t pointCommands(const uint8_t *x, const uint8_t *y, uint8_t count, const uint8_t *order);
+static void drawCharacterRow(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint8_t row);
+static bool clipBounds(oledc_rect_t *bounds, int16_t xs, int16_t ys, int16_t xe, int16_t ye);
+static bool pushFrame(int16_t xs, int16_t ys, int16_t xe, int16_t ye, int16_t origin_x, int16_t origin_y);
+static void drawGlyphOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint16_t background, bool gap);
+
+static oledc_text_stats_t textStats;
+static uint16_t glyphRow[5 * OLED_TEXT_MAX_SCALE + 1];
+static uint8_t pointOrder[255];     /* oledC_DrawPoints() sort */
+static uint8_t pointRepeat[32];     /* points given earlier in the list, one bit each */
+
+
+/* Returns the previous target so callers can restore it */
+const oledc_target_t *oledC_setTarget(const oledc_target_t *newTarget)
+{
+    const oledc_target_t *previous = target;
+    target = newTarget;
+    return previous;
+}
+
+const oledc_target_t *oledC_getTarget(void)
+{
+    return target;
+}
+
+/* Panel rectangle (xs..xe, ys..ye) cut by the current clip, with a new origin */
+static bool pushFrame(int16_t xs, int16_t ys, int16_t xe, int16_t ye, int16_t origin_x, int16_t origin_y)
+{
+    const oledc_rect_t *outer = &clipStack[clipDepth].rect;
+    clip_frame_t *frame;
+
+    if(clipDepth == OLEDC_CLIP_DEPTH)
+    {
+        return false;
+    }
+    frame = &clipStack[++clipDepth];
+    xs = xs < outer->xs ? outer->xs : xs;
+    ys = ys < outer->ys ? outer->ys : ys;
+    xe = xe > outer->xe ? outer->xe : xe;
+    ye = ye > outer->ye ? outer->ye : ye;
+    if(xs > xe || ys > ye)
+    {
+        xs = 1;
+        xe = 0;
+        ys = 1;
+        ye = 0;
+    }
+    frame->rect.xs = xs;
+    frame->rect.ys = ys;
+    frame->rect.xe = xe;
+    frame->rect.ye = ye;
+    frame->x = origin_x;
+    frame->y = origin_y;
+    return true;
+}
+
+bool oledC_pushClip(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y)
+{
+    const clip_frame_t *frame = &clipStack[clipDepth];
+    return pushFrame(frame->x + start_x, frame->y + start_y, frame->x + end_x, frame->y + end_y, frame->x, frame->y);
+}
+
+bool oledC_pushViewport(uint8_t x, uint8_t y, uint8_t width, uint8_t height)
+{
+    const clip_frame_t *frame = &clipStack[clipDepth];
+    int16_t origin_x = frame->x + x, origin_y = frame->y + y;
+    return pushFrame(origin_x, origin_y, origin_x + width - 1, origin_y + height - 1, origin_x, origin_y);
+}
 
+void oledC_popClip(void)
+{
+    if(clipDepth > 0)
+    {
+        clipDepth--;
+    }
+}
+
+uint8_t oledC_clipDepth(void)
+{
+    return clipDepth;
+}
+
+bool oledC_clipWindow(uint8_t x, uint8_t y, uint16_t width, uint16_t height, oledc_rect_t *window)
+{
+    const clip_frame_t *frame = &clipStack[clipDepth];
+    int16_t xs = frame->x + x, ys = frame->y + y;
+    int16_t xe = xs + (int16_t)width - 1, ye = ys + (int16_t)height - 1;
+
+    if(width == 0 || height == 0 || xs < frame->rect.xs || xs > frame->rect.xe
+        || ys < frame->rect.ys || ys > frame->rect.ye)
+    {
+        return false;
+    }
+    window->xs = xs;
+    window->ys = ys;
+    window->xe = xe > frame->rect.xe ? frame->rect.xe : xe;
+    window->ye = ye > frame->rect.ye ? frame->rect.ye : ye;
+    return true;
+}
 
 void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shape_t *newShape)
 {
@@ -57,6 +183,10 @@ void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shap
             newShape->params.ring = params->ring;
             newShape->draw = drawRing;
             break;
+        case OLED_SHAPE_ARC:
+            newShape->params.arc = params->arc;
+            newShape->draw = drawArc;
+            break;
         case OLED_SHAPE_RECTANGLE:
             newShape->params.rectangle = params->rectangle;
             newShape->draw = drawRectangle;
@@ -77,12 +207,244 @@ void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shap
             newShape->params.bitmap = params->bitmap;
             newShape->draw = drawBitmap;
             break;
+        case OLED_SHAPE_PACKED_BITMAP:
+            newShape->params.packedBitmap = params->packedBitmap;
+            newShape->draw = drawPackedBitmap;
+            break;
+        case OLED_SHAPE_POINTS:
+            newShape->params.points = params->points;
+            newShape->draw = drawPoints;
+            break;
+        case OLED_SHAPE_POLYLINE:
+            newShape->params.polyline = params->polyline;
+            newShape->draw = drawPolyline;
+            break;
         default: 
             newShape->draw = drawPoint;
             break;
     }
 }
 
+static bool clipBounds(oledc_rect_t *bounds, int16_t xs, int16_t ys, int16_t xe, int16_t ye)
+{
+    xs = xs < 0 ? 0 : xs;
+    ys = ys < 0 ? 0 : ys;
+    xe = xe > OLED_DIM_WIDTH ? OLED_DIM_WIDTH : xe;
+    ye = ye > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : ye;
+    if(xs > xe || ys > ye)
+    {
+        return false;
+    }
+    bounds->xs = xs;
+    bounds->ys = ys;
+    bounds->xe = xe;
+    bounds->ye = ye;
+    return true;
+}
+
+/* 
+ * On-screen box that holds every pixel the shape draws (may be a little
+ * larger for lines). Returns false when nothing of it is visible.
+ */
+bool oledC_getShapeBounds(shape_t *shape, oledc_rect_t *bounds)
+{
+    shape_params_t *p = &shape->params;
+    int16_t r, w, sx, sy;
+    uint8_t i, length;
+
+    switch(shape->_type)
+    {
+        case OLED_SHAPE_CIRCLE:
+            r = p->circle.radius <= 1 ? 1 : p->circle.radius;
+            return clipBounds(bounds, p->circle.xc - r, p->circle.yc - r, p->circle.xc + r, p->circle.yc + r);
+        case OLED_SHAPE_RING:
+            r = p->ring.radius + (p->ring.width >> 1);
+            return clipBounds(bounds, p->ring.x0 - r, p->ring.y0 - r, p->ring.x0 + r, p->ring.y0 + r);
+        case OLED_SHAPE_ARC:
+            r = p->arc.radius + (p->arc.width >> 1);
+            return clipBounds(bounds, p->arc.x0 - r, p->arc.y0 - r, p->arc.x0 + r, p->arc.y0 + r);
+        case OLED_SHAPE_RECTANGLE:
+            return clipBounds(bounds, p->rectangle.xs, p->rectangle.ys, p->rectangle.xe, p->rectangle.ye);
+        case OLED_SHAPE_LINE:
+            w = p->line.width / 2;
+            return clipBounds(bounds,
+                (p->line.xs < p->line.xe ? p->line.xs : p->line.xe) - w,
+                (p->line.ys < p->line.ye ? p->line.ys : p->line.ye) - w,
+                (p->line.xs < p->line.xe ? p->line.xe : p->line.xs) + w,
+                (p->line.ys < p->line.ye ? p->line.ye : p->line.ys) + w);
+        case OLED_SHAPE_CHARACTER:
+            sx = p->character.scale_x;
+            sy = p->character.scale_y;
+            return clipBounds(bounds, p->character.x, p->character.y + sy,
+                p->character.x + OLED_FONT_WIDTH * sx - 1, p->character.y + (OLED_FONT_HEIGHT + 1) * sy - 1);
+        case OLED_SHAPE_STRING:
+            if(p->string.font != NULL)
+            {
+                w = oledC_fontStringWidth(p->string.font, p->string.string);
+                return w > 0 && clipBounds(bounds, p->string.x, p->string.y,
+                    p->string.x + w - 1, p->string.y + p->string.font->height - 1);
+            }
+            sx = p->string.scale_x;
+            sy = p->string.scale_y;
+            for(length = 0; p->string.string[length]; length++);
+            return length > 0 && clipBounds(bounds, p->string.x, p->string.y + sy,
+                p->string.x + length * (OLED_FONT_WIDTH * sx + 1) - 2, p->string.y + (OLED_FONT_HEIGHT + 1) * sy - 1);
+        case OLED_SHAPE_BITMAP:
+            sx = p->bitmap.sx == 0 ? 1 : p->bitmap.sx;
+            sy = p->bitmap.sy == 0 ? 1 : p->bitmap.sy;
+            return clipBounds(bounds, legacyBitmapX(p->bitmap.x, sx), p->bitmap.y,
+                legacyBitmapX(p->bitmap.x, sx) + 32 * sx - 1, p->bitmap.y + p->bitmap.array_length * sy - 1);
+        case OLED_SHAPE_PACKED_BITMAP:
+            sx = p->packedBitmap.sx == 0 ? 1 : p->packedBitmap.sx;
+            sy = p->packedBitmap.sy == 0 ? 1 : p->packedBitmap.sy;
+            return clipBounds(bounds, p->packedBitmap.x, p->packedBitmap.y,
+                p->packedBitmap.x + p->packedBitmap.bitmap->width * sx - 1,
+                p->packedBitmap.y + p->packedBitmap.bitmap->height * sy - 1);
+        case OLED_SHAPE_POLYLINE:
+            /* Same bounds as its vertices, widened by the line width */
+            w = p->polyline.width / 2;
+            bounds->xs = bounds->ys = 0xFF;
+            bounds->xe = bounds->ye = 0;
+            for(i = 0; i < p->polyline.count; i++)
+            {
+                bounds->xs = p->polyline.x[i] < bounds->xs ? p->polyline.x[i] : bounds->xs;
+                bounds->xe = p->polyline.x[i] > bounds->xe ? p->polyline.x[i] : bounds->xe;
+                bounds->ys = p->polyline.y[i] < bounds->ys ? p->polyline.y[i] : bounds->ys;
+                bounds->ye = p->polyline.y[i] > bounds->ye ? p->polyline.y[i] : bounds->ye;
+            }
+            return p->polyline.count > 0 && clipBounds(bounds, bounds->xs - w, bounds->ys - w, bounds->xe + w, bounds->ye + w);
+        case OLED_SHAPE_POINTS:
+            bounds->xs = bounds->ys = 0xFF;
+            bounds->xe = bounds->ye = 0;
+            for(i = 0; i < p->points.count; i++)
+            {
+                if(p->points.x[i] > OLED_DIM_WIDTH || p->points.y[i] > OLED_DIM_HEIGHT)
+                {
+                    continue;
+                }
+                bounds->xs = p->points.x[i] < bounds->xs ? p->points.x[i] : bounds->xs;
+                bounds->xe = p->points.x[i] > bounds->xe ? p->points.x[i] : bounds->xe;
+                bounds->ys = p->points.y[i] < bounds->ys ? p->points.y[i] : bounds->ys;
+                bounds->ye = p->points.y[i] > bounds->ye ? p->points.y[i] : bounds->ye;
+            }
+            return bounds->xs <= bounds->xe;
+        default:
+            return clipBounds(bounds, p->point.x, p->point.y, p->point.x, p->point.y);
+    }
+}
+
+/*
+ * Draws only the part of the shape on one panel row, through the current
+ * target. Text, rectangles, bitmaps and points go straight to that row;
+ * curves are drawn whole and left to the target to clip.
+ */
+void oledC_drawShapeRow(shape_t *shape, uint8_t row)
+{
+    shape_params_t *p = &shape->params;
+    uint8_t i, x, sx, sy;
+    int16_t r;
+    uint8_t *string;
+
+    switch(shape->_type)
+    {
+        case OLED_SHAPE_RECTANGLE:
+            if(row >= p->rectangle.ys && row <= p->rectangle.ye)
+            {
+                oledC_DrawRectangle(p->rectangle.xs, row, p->rectangle.xe, row, p->rectangle.color);
+            }
+            break;
+        case OLED_SHAPE_CHARACTER:
+            drawCharacterRow(p->character.x, p->character.y, p->character.scale_x, p->character.scale_y,
+                p->character.character, p->character.color, row);
+            break;
+        case OLED_SHAPE_STRING:
+            x = p->string.x;
+            if(p->string.font != NULL)
+            {
+                for(string = p->string.string; *string; string++)
+                {
+                    oledC_fontDrawGlyphRow(p->string.font, x, p->string.y, *string, p->string.color, row);
+                    x += oledC_fontAdvance(p->string.font, *string);
+                }
+                break;
+            }
+            for(string = p->string.string; *string; string++)
+            {
+                drawCharacterRow(x, p->string.y, p->string.scale_x, p->string.scale_y, *string, p->string.color, row);
+                x += OLED_FONT_WIDTH * p->string.scale_x + 1;
+            }
+            break;
+        case OLED_SHAPE_BITMAP:
+            sx = p->bitmap.sx == 0 ? 1 : p->bitmap.sx;
+            sy = p->bitmap.sy == 0 ? 1 : p->bitmap.sy;
+            if(row >= p->bitmap.y && (row - p->bitmap.y) / sy < p->bitmap.array_length)
+            {
+                drawBitmapSpans(legacyBitmapX(p->bitmap.x, sx), row, row,
+                    ~p->bitmap.bit_array[(row - p->bitmap.y) / sy], 32, sx, p->bitmap.color, 0, true);
+            }
+            break;
+        case OLED_SHAPE_PACKED_BITMAP:
+            sx = p->packedBitmap.sx == 0 ? 1 : p->packedBitmap.sx;
+            sy = p->packedBitmap.sy == 0 ? 1 : p->packedBitmap.sy;
+            if(row >= p->packedBitmap.y && (row - p->packedBitmap.y) / sy < p->packedBitmap.bitmap->height)
+            {
+                drawBitmapSpans(p->packedBitmap.x, row, row,
+                    oledC_bitmapRow(p->packedBitmap.bitmap, (row - p->packedBitmap.y) / sy),
+                    p->packedBitmap.bitmap->width, sx, p->packedBitmap.color,
+                    p->packedBitmap.background, p->packedBitmap.transparent);
+            }
+            break;
+        case OLED_SHAPE_CIRCLE:
+            fillArc(p->circle.xc, p->circle.yc, p->circle.radius <= 1 ? 1 : p->circle.radius, -1,
+                0, 360, row, p->circle.color);
+            break;
+        case OLED_SHAPE_RING:
+            r = p->ring.radius + (p->ring.width >> 1);
+            fillArc(p->ring.x0, p->ring.y0, r, r - p->ring.width, 0, 360, row, p->ring.color);
+            break;
+        case OLED_SHAPE_ARC:
+            r = p->arc.radius + (p->arc.width >> 1);
+            fillArc(p->arc.x0, p->arc.y0, r, r - p->arc.width, p->arc.start, p->arc.end, row, p->arc.color);
+            break;
+        case OLED_SHAPE_POINT:
+            if(p->point.y == row)
+            {
+                oledC_DrawPoint(p->point.x, row, p->point.color);
+            }
+            break;
+        case OLED_SHAPE_POLYLINE:
+            /* Only the segments that reach this row */
+            sx = p->polyline.width / 2;
+            if(p->polyline.count == 1)
+            {
+                shape->draw(shape);
+            }
+            for(i = 1; i < p->polyline.count; i++)
+            {
+                uint8_t top = p->polyline.y[i-1] < p->polyline.y[i] ? p->polyline.y[i-1] : p->polyline.y[i];
+                uint8_t bottom = p->polyline.y[i-1] < p->polyline.y[i] ? p->polyline.y[i] : p->polyline.y[i-1];
+                if(row + sx >= top && row <= bottom + sx)
+                {
+                    oledC_DrawLine(p->polyline.x[i-1], p->polyline.y[i-1], p->polyline.x[i], p->polyline.y[i],
+                        p->polyline.width, p->polyline.color);
+                }
+            }
+            break;
+        case OLED_SHAPE_POINTS:
+            for(i = 0; i < p->points.count; i++)
+            {
+                if(p->points.y[i] == row)
+                {
+                    oledC_DrawPoint(p->points.x[i], row, p->points.color);
+                }
+            }
+            break;
+        default:
+            shape->draw(shape);
+            break;
+    }
+}
+
 static const uint8_t font[] = 
     { // compact 5x8 font
     0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFA,0x00,0x00,0x00,0xE0,0x00,0xE0,0x00, //	'sp,!,"
@@ -149,13 +511,119 @@ uint16_t oledC_ReadPoint(uint8_t x, uint8_t y)
 
 void oledC_DrawPoint(uint8_t x, uint8_t y, uint16_t color)
 {
-    if(x > OLED_DIM_WIDTH || y > OLED_DIM_HEIGHT)
+    oledc_rect_t pixel;
+
+    if(!oledC_clipWindow(x, y, 1, 1, &pixel))
     {
         return;
     }
-    oledC_setColumnAddressBounds(x,95);
-    oledC_setRowAddressBounds(y,95);
+    if(target != NULL)
+    {
+        target->fillRect(pixel.xs, pixel.ys, pixel.xs, pixel.ys, color);
+        return;
+    }
+    oledC_setWritePosition(pixel.xs, pixel.ys);
+    oledC_sendColorInt(color);
+}
+
+/* A run of neighbouring pixels on one row, left to right */
+static void drawPointRun(uint8_t x, uint8_t y, uint16_t length, uint16_t color)
+{
+    oledc_rect_t run;
+
+    if(target != NULL || !oledC_clipWindow(x, y, length, 1, &run))
+    {
+        oledC_DrawRectangle(x, y, x + length - 1, y, color);
+        return;
+    }
+    /* Point-style bounds, so the window cache still holds for the next run */
+    oledC_setWritePosition(run.xs, run.ys);
     oledC_sendColorInt(color);
+    if(run.xe > run.xs)
+    {
+        oledC_pushRepeat(color, run.xe - run.xs);
+    }
+}
+
+/*
+ * Bound and write commands needed to plot the points in this order: the
+ * write pointer steps one column right after each pixel, so only a point
+ * that does not sit there costs a column and/or row command.
+ */
+static uint16_t pointCommands(const uint8_t *x, const uint8_t *y, uint8_t count, const uint8_t *order)
+{
+    uint16_t commands = 3;
+    uint8_t i, p, q;
+
+    for(i = 1; i < count; i++)
+    {
+        p = order == NULL ? i : order[i];
+        q = order == NULL ? i - 1 : order[i - 1];
+        if(y[p] == y[q] && x[p] == x[q])
+        {
+            continue;
+        }
+        commands += (x[p] != x[q] + 1) + (y[p] != y[q]);
+        commands += (x[p] != x[q] + 1 || y[p] != y[q]);
+    }
+    return commands;
+}
+
+/*
+ * Sorted by panel address, neighbours on a row go out as one burst and a
+ * later point on the same row only needs a column command. Points given
+ * twice are plotted once. When the caller's order already needs fewer
+ * commands (e.g. a trace stepping one column at a time) it is kept.
+ */
+void oledC_DrawPoints(const uint8_t *x, const uint8_t *y, uint8_t count, uint16_t color)
+{
+    uint8_t i, j, first, previous, next;
+    uint16_t key;
+
+    for(i = 0; i < count; i++)
+    {
+        key = ((uint16_t)y[i] << 8) | x[i];
+        for(j = i; j > 0 && (((uint16_t)y[pointOrder[j - 1]] << 8) | x[pointOrder[j - 1]]) > key; j--)
+        {
+            pointOrder[j] = pointOrder[j - 1];
+        }
+        pointOrder[j] = i;
+    }
+    if(target == NULL && pointCommands(x, y, count, NULL) < pointCommands(x, y, count, pointOrder))
+    {
+        /* The sort is stable, so a repeat follows its first occurrence */
+        memset(pointRepeat, 0, sizeof pointRepeat);
+        for(i = 1; i < count; i++)
+        {
+            if(x[pointOrder[i]] == x[pointOrder[i - 1]] && y[pointOrder[i]] == y[pointOrder[i - 1]])
+            {
+                pointRepeat[pointOrder[i] >> 3] |= 1 << (pointOrder[i] & 7);
+            }
+        }
+        for(i = 0; i < count; i++)
+        {
+            if(!(pointRepeat[i >> 3] & (1 << (i & 7))))
+            {
+                oledC_DrawPoint(x[i], y[i], color);
+            }
+        }
+        return;
+    }
+    for(i = 0; i < count; i = j)
+    {
+        first = pointOrder[i];
+        previous = first;
+        for(j = i + 1; j < count; j++)
+        {
+            next = pointOrder[j];
+            if(y[next] != y[first] || (x[next] != x[previous] && x[next] != x[previous] + 1))
+            {
+                break;
+            }
+            previous = next;
+        }
+        drawPointRun(x[first], y[first], (uint16_t)x[previous] - x[first] + 1, color);
+    }
 }
 
 void oledC_DrawThickPoint(uint8_t center_x, uint8_t center_y, uint8_t width, uint16_t color)
@@ -186,123 +654,315 @@ void oledC_DrawThickPoint(uint8_t center_x, uint8_t center_y, uint8_t width, uin
     }
 }
 
-void oledC_DrawCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint16_t color)
+/* round(255 * sin(deg)) for 0..90 degrees */
+static const uint8_t sineTable[91] =
 {
-    int8_t xCurr, yMax = 0, y = 0, x=0;
-    int16_t d = 0;
-   
-    radius = radius <= 1 ? 1 : radius;
-    xCurr = radius+1;
-    yMax = 0;
-    y = 0;
-    d = 0;
+      0,   4,   9,  13,  18,  22,  27,  31,  35,  40,  44,  49,  53,  57,  62,  66,
+     70,  75,  79,  83,  87,  91,  96, 100, 104, 108, 112, 116, 120, 124, 127, 131,
+    135, 139, 143, 146, 150, 153, 157, 160, 164, 167, 171, 174, 177, 180, 183, 186,
+    190, 192, 195, 198, 201, 204, 206, 209, 211, 214, 216, 219, 221, 223, 225, 227,
+    229, 231, 233, 235, 236, 238, 240, 241, 243, 244, 245, 246, 247, 248, 249, 250,
+    251, 252, 253, 253, 254, 254, 254, 255, 255, 255, 255
+};
 
-    while (xCurr >= yMax)
+/* Pixels clockwise of a start ray and short of an end ray */
+typedef struct arc_sector_t
+{
+    int16_t startX, startY;
+    int16_t endX, endY;
+    bool wide;              /* sweep over 180 degrees */
+} arc_sector_t;
+
+/* Unit vector (x255) for an angle clockwise from 12 o'clock, y down */
+static void angleVector(uint16_t angle, int16_t *x, int16_t *y)
+{
+    int16_t s, c;
+    angle %= 360;
+    s = sineTable[angle % 90];
+    c = sineTable[90 - angle % 90];
+    switch(angle / 90)
+    {
+        case 0:  *x = s;  *y = -c; break;
+        case 1:  *x = c;  *y = s;  break;
+        case 2:  *x = -s; *y = c;  break;
+        default: *x = -c; *y = -s; break;
+    }
+}
+
+/* True when (px, py) lies in the half turn starting at the ray */
+static bool pastRay(int16_t rx, int16_t ry, int16_t px, int16_t py)
+{
+    int32_t cross = (int32_t)rx * py - (int32_t)ry * px;
+    return cross > 0 || (cross == 0 && (int32_t)rx * px + (int32_t)ry * py > 0);
+}
+
+static bool inSector(const arc_sector_t *sector, int16_t px, int16_t py)
+{
+    bool afterStart, afterEnd;
+    if(px == 0 && py == 0)
+    {
+        py = -1;    /* the centre belongs with 12 o'clock */
+    }
+    afterStart = pastRay(sector->startX, sector->startY, px, py);
+    afterEnd = pastRay(sector->endX, sector->endY, px, py);
+    return sector->wide ? (afterStart || !afterEnd) : (afterStart && !afterEnd);
+}
+
+/* Row y, columns x0+dxs..x0+dxe; with a sector only the runs inside it */
+static void fillArcRun(int16_t x0, int16_t y, int16_t dy, int16_t dxs, int16_t dxe,
+    const arc_sector_t *sector, uint16_t color)
+{
+    int16_t dx, runStart = 0;
+    bool inRun = false;
+
+    if(y < 0 || y > OLED_DIM_HEIGHT)
+    {
+        return;
+    }
+    dxs = x0 + dxs < 0 ? -x0 : dxs;
+    dxe = x0 + dxe > OLED_DIM_WIDTH ? OLED_DIM_WIDTH - x0 : dxe;
+    if(sector == NULL)
     {
-        d += (2*yMax+1);
-        yMax++;
-        if(d >= 0)
+        if(dxs <= dxe)
         {
-            for(y = y; y < yMax; y++)
-            {
-                for(x = y; x < xCurr; x++)
-                {
-                    oledC_DrawPoint(x0 + x,y0 + y, color);
-                    oledC_DrawPoint(x0 + x,y0 - y, color);
-                    oledC_DrawPoint(x0 - x,y0 + y, color);
-                    oledC_DrawPoint(x0 - x,y0 - y, color);    
-                    oledC_DrawPoint(x0 + y,y0 + x, color);
-                    oledC_DrawPoint(x0 + y,y0 - x, color);
-                    oledC_DrawPoint(x0 - y,y0 + x, color);
-                    oledC_DrawPoint(x0 - y,y0 - x, color);
-                }
-            }
-            d += -2*xCurr + 1;
-            xCurr--;
+            oledC_DrawRectangle(x0 + dxs, y, x0 + dxe, y, color);
         }
+        return;
+    }
+    for(dx = dxs; dx <= dxe + 1; dx++)
+    {
+        bool in = dx <= dxe && inSector(sector, dx, dy);
+        if(in && !inRun)
+        {
+            runStart = dx;
+        }
+        else if(!in && inRun)
+        {
+            oledC_DrawRectangle(x0 + runStart, y, x0 + dx - 1, y, color);
+        }
+        inRun = in;
     }
 }
 
-void oledC_DrawRing(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t width, uint16_t color)
+/*
+ * Pixels whose centres lie within outer + 1/2 of the centre but not within
+ * inner + 1/2 (inner < 0 fills the disc), limited to the [start, end)
+ * sector. Each row of the band is one or two spans, so every pixel is
+ * written once. row >= 0 draws only that panel row.
+ */
+static void fillArc(int16_t x0, int16_t y0, int16_t outer, int16_t inner,
+    uint16_t start, uint16_t end, int16_t row, uint16_t color)
 {
-    int8_t x, y;
-    int16_t d;
-    radius += width >> 1;
-    while(width-- > 0)
-    {
-        x = radius;
-        y = 0;
-        d = 0;
+    arc_sector_t sector;
+    const arc_sector_t *clip = NULL;
+    uint16_t sweep = end >= start ? end - start : end + 360 - start;
+    uint16_t outerLimit, innerLimit, dy2;
+    int16_t xo, xi, dy, dyRow, y;
+    uint8_t side;
 
-        while (x >= y)
+    if(outer < 0 || outer > 0xFE || sweep == 0 || inner >= outer)
+    {
+        return;
+    }
+    if(sweep < 360)
+    {
+        angleVector(start, &sector.startX, &sector.startY);
+        angleVector(end, &sector.endX, &sector.endY);
+        sector.wide = sweep > 180;
+        clip = &sector;
+    }
+    dyRow = row < 0 ? outer : (row > y0 ? row - y0 : y0 - row);
+    outerLimit = (uint16_t)outer * outer + outer;
+    innerLimit = inner < 0 ? 0 : (uint16_t)inner * inner + inner;
+    xo = outer;
+    xi = inner;
+    for(dy = 0; dy <= outer && dy <= dyRow; dy++)
+    {
+        dy2 = (uint16_t)dy * dy;
+        while((uint16_t)xo * xo > outerLimit - dy2)
+        {
+            xo--;
+        }
+        if(dy > inner)
+        {
+            xi = -1;
+        }
+        while(xi >= 0 && (uint16_t)xi * xi > innerLimit - dy2)
         {
-            oledC_DrawPoint(x0 + x,y0 + y, color);
-            oledC_DrawPoint(x0 + x,y0 - y, color);
-            oledC_DrawPoint(x0 - x,y0 + y, color);
-            oledC_DrawPoint(x0 - x,y0 - y, color);    
-            oledC_DrawPoint(x0 + y,y0 + x, color);
-            oledC_DrawPoint(x0 + y,y0 - x, color);
-            oledC_DrawPoint(x0 - y,y0 + x, color);
-            oledC_DrawPoint(x0 - y,y0 - x, color);
-            
-            d += (2*y+1);
-            y++;
-            if(d >= 0)
+            xi--;
+        }
+        if(row >= 0 && dy != dyRow)
+        {
+            continue;
+        }
+        for(side = 0; side < (dy == 0 ? 1 : 2); side++)
+        {
+            int16_t rdy = side ? dy : -dy;
+            y = y0 + rdy;
+            if(row >= 0 && y != row)
+            {
+                continue;
+            }
+            if(xi < 0)
             {
-                d += -2*x + 1;
-                x--;
+                fillArcRun(x0, y, rdy, -xo, xo, clip, color);
+            }
+            else
+            {
+                fillArcRun(x0, y, rdy, -xo, -xi - 1, clip, color);
+                fillArcRun(x0, y, rdy, xi + 1, xo, clip, color);
             }
         }
-        radius--;
     }
 }
 
+void oledC_DrawCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint16_t color)
+{
+    fillArc(x0, y0, radius <= 1 ? 1 : radius, -1, 0, 360, -1, color);
+}
+
+void oledC_DrawRing(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t width, uint16_t color)
+{
+    int16_t outer = radius + (width >> 1);
+    fillArc(x0, y0, outer, outer - width, 0, 360, -1, color);
+}
+
+void oledC_DrawArc(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t width, uint16_t start_angle, uint16_t end_angle, uint16_t color)
+{
+    int16_t outer = radius + (width >> 1);
+    fillArc(x0, y0, outer, outer - width, start_angle, end_angle, -1, color);
+}
+
+/* Rectangle with signed corners, clipped to the panel */
+static void fillSpan(int16_t xs, int16_t ys, int16_t xe, int16_t ye, uint16_t color)
+{
+    if(xe < 0 || ye < 0 || xs > OLED_DIM_WIDTH || ys > OLED_DIM_HEIGHT)
+    {
+        return;
+    }
+    oledC_DrawRectangle(xs < 0 ? 0 : xs, ys < 0 ? 0 : ys,
+        xe > OLED_DIM_WIDTH ? OLED_DIM_WIDTH : xe, ye > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : ye, color);
+}
+
+/*
+ * Bresenham for every octant, both end points included. Pixels that share
+ * a row (shallow lines) or a column (steep lines) are sent as one span; a
+ * thick line sweeps a span of width pixels across the minor axis instead.
+ */
 void oledC_DrawLine(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t width, uint16_t color)
 {
-    int8_t x, y;
-    int8_t dx, dy, D;
+    int16_t dx = x1 > x0 ? x1 - x0 : x0 - x1;
+    int16_t dy = y1 > y0 ? y0 - y1 : y1 - y0;
+    int8_t sx = x0 < x1 ? 1 : -1;
+    int8_t sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy, e2;
+    int16_t x = x0, y = y0, nx, ny, runStart;
+    uint8_t lo, hi;
+    bool steep = -dy > dx;
+
     width = width <= 1 ? 1 : width;
-    
-    dx = x1 - x0;
-    dy = y1 - y0;
-    D = dy - dx;
-    y = y0;
-    
-    for(x = x0; x < x1; x++)
+    lo = (width - 1) / 2;
+    hi = width / 2;
+    runStart = steep ? y : x;
+    for(;;)
     {
-        if(x <= OLED_DIM_WIDTH && y <= OLED_DIM_HEIGHT)
+        bool last = (x == x1 && y == y1);
+        nx = x;
+        ny = y;
+        if(!last)
+        {
+            e2 = 2 * err;
+            if(e2 >= dy)
+            {
+                err += dy;
+                nx += sx;
+            }
+            if(e2 <= dx)
+            {
+                err += dx;
+                ny += sy;
+            }
+        }
+        if(last || (steep ? nx != x : ny != y))
         {
-            if(width <= 1)
+            if(steep)
             {
-                oledC_DrawPoint(x,y, color);
-            } 
-            else 
+                fillSpan(x - lo, runStart < y ? runStart : y, x + hi, runStart < y ? y : runStart, color);
+                runStart = ny;
+            }
+            else
             {
-                oledC_DrawCircle(x, y, width/2, color);
+                fillSpan(runStart < x ? runStart : x, y - lo, runStart < x ? x : runStart, y + hi, color);
+                runStart = nx;
             }
         }
-        if(D >= 0)
+        if(last)
         {
-            y = y+1;
-            D = D - dx;
+            break;
         }
-        D = D + dy;
+        x = nx;
+        y = ny;
     }
 }
 
+void oledC_DrawPolyline(const uint8_t *x, const uint8_t *y, uint8_t count, uint8_t width, uint16_t color)
+{
+    uint8_t i;
+    if(count == 1)
+    {
+        oledC_DrawLine(x[0], y[0], x[0], y[0], width, color);
+    }
+    for(i = 1; i < count; i++)
+    {
+        oledC_DrawLine(x[i-1], y[i-1], x[i], y[i], width, color);
+    }
+}
+
+/* Every span of every primitive passes through here: viewport, then clip */
 void oledC_DrawRectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
 {
-    uint8_t x;
-    uint8_t y;
-    oledC_setColumnAddressBounds(start_x,end_x);
-    oledC_setRowAddressBounds(start_y,end_y);
-    for(x = start_x; x < end_x+1; x++)
+    const clip_frame_t *frame = &clipStack[clipDepth];
+    int16_t xs = frame->x + start_x, ys = frame->y + start_y;
+    int16_t xe = frame->x + end_x, ye = frame->y + end_y;
+
+    xs = xs < frame->rect.xs ? frame->rect.xs : xs;
+    ys = ys < frame->rect.ys ? frame->rect.ys : ys;
+    xe = xe > frame->rect.xe ? frame->rect.xe : xe;
+    ye = ye > frame->rect.ye ? frame->rect.ye : ye;
+    if(xs > xe || ys > ye)
+    {
+        return;
+    }
+    oledC_fillPanelRect(xs, ys, xe, ye, color);
+}
+
+void oledC_fillPanelRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint16_t count;
+
+    end_x = end_x > OLED_DIM_WIDTH ? OLED_DIM_WIDTH : end_x;
+    end_y = end_y > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : end_y;
+    if(start_x > end_x || start_y > end_y)
+    {
+        return;
+    }
+    if(target != NULL)
     {
-        for(y = start_y; y < end_y+1; y++)
+        target->fillRect(start_x, start_y, end_x, end_y, color);
+        return;
+    }
+    count = (uint16_t)(end_x - start_x + 1) * (end_y - start_y + 1);
+    if(count >= OLED_DMA_FILL_MIN)
+    {
+        oledc_flush_job_t job = {start_x, start_y, end_x, end_y, NULL, color, NULL};
+        if(oledC_queueFlush(&job))
         {
-            oledC_sendColorInt(color);
+            return;
         }
     }
+    oledC_beginWindow(start_x, start_y, end_x, end_y);
+    oledC_pushRepeat(color, count);
+    oledC_endWindow();
 }
 
 void oledC_DrawCharacter(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color)
@@ -325,8 +985,33 @@ void oledC_DrawCharacter(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t c
     }
 }
 
-void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color)
+/* One row of oledC_DrawCharacter(): glyph bit k lands on rows y + (8-k)*sy */
+static void drawCharacterRow(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint8_t row)
+{
+    const uint8_t *f = &font[(ch-' ')*OLED_FONT_WIDTH];
+    uint8_t line, bit, i_x;
+
+    if(sy == 0 || row < y + sy || row >= y + (OLED_FONT_HEIGHT + 1) * sy)
+    {
+        return;
+    }
+    line = (row - y) / sy;
+    bit = 1 << (OLED_FONT_HEIGHT - line);
+    for(i_x = 0; i_x < OLED_FONT_WIDTH * sx; i_x += sx)
+    {
+        if(*f++ & bit)
+        {
+            oledC_DrawRectangle(x+i_x, row, x+i_x+sx-1, row, color);
+        }
+    }
+}
+
+void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color, const oledc_font_t *font)
 {
+    while(*string && font != NULL)
+    {
+        x += oledC_fontDrawGlyph(font, x, y, *string++, color);
+    }
     while(*string)
     {
         oledC_DrawCharacter(x, y, sx, sy, *string++, color);
@@ -334,27 +1019,235 @@ void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *str
     }
 }
 
+/*
+ * Opaque text: every glyph cell, gap column included, is one window that
+ * gets foreground and background pixels in a single pass, so old text
+ * does not have to be erased first. Bit 0 is the blank bottom row of every
+ * glyph, so a cell covers bits 7..1: rows y+sy .. y+8*sy-1.
+ */
+static void drawGlyphOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint16_t background, bool gap)
+{
+    const uint8_t *f = &font[(ch-' ')*OLED_FONT_WIDTH];
+    uint16_t top = y + sy;
+    uint8_t width = OLED_FONT_WIDTH * sx + (gap ? 1 : 0);
+    uint8_t end_y, row, bit, c, i, r, start;
+    uint16_t *p;
+    oledc_rect_t window;
+
+    if(sx == 0 || sy == 0 || x > OLED_DIM_WIDTH || top > OLED_DIM_HEIGHT)
+    {
+        return;
+    }
+    end_y = (top + 7 * sy - 1) > OLED_DIM_HEIGHT ? OLED_DIM_HEIGHT : (top + 7 * sy - 1);
+
+    if(target != NULL || sx > OLED_TEXT_MAX_SCALE || !oledC_clipWindow(x, top, width, 7 * sy, &window))
+    {
+        /* Same cell as runs of equal colour, so render targets and clipping can take it */
+        for(bit = 0x80, row = top; bit > 0x01 && row <= end_y; bit >>= 1, row += sy)
+        {
+            uint16_t runColor = (f[0] & bit) ? color : background;
+            start = x;
+            for(c = 1; c < OLED_FONT_WIDTH; c++)
+            {
+                uint16_t next = (f[c] & bit) ? color : background;
+                if(next != runColor)
+                {
+                    oledC_DrawRectangle(start, row, x + c * sx - 1, row + sy - 1, runColor);
+                    start = x + c * sx;
+                    runColor = next;
+                }
+            }
+            if(gap && runColor != background)
+            {
+                oledC_DrawRectangle(start, row, x + OLED_FONT_WIDTH * sx - 1, row + sy - 1, runColor);
+                start = x + OLED_FONT_WIDTH * sx;
+                runColor = background;
+            }
+            oledC_DrawRectangle(start, row, x + width - 1, row + sy - 1, runColor);
+        }
+        return;
+    }
+
+    oledC_beginWindow(window.xs, window.ys, window.xe, window.ye);
+    textStats.glyphs++;
+    textStats.pixels += (window.xe - window.xs + 1) * (window.ye - window.ys + 1);
+    for(bit = 0x80, row = window.ys; bit > 0x01 && row <= window.ye; bit >>= 1)
+    {
+        p = glyphRow;
+        for(c = 0; c < OLED_FONT_WIDTH; c++)
+        {
+            for(i = 0; i < sx; i++)
+            {
+                *p++ = (f[c] & bit) ? color : background;
+            }
+        }
+        *p = background;
+        for(r = 0; r < sy && row <= window.ye; r++, row++)
+        {
+            oledC_pushColors(glyphRow, window.xe - window.xs + 1);
+        }
+    }
+    oledC_endWindow();
+}
+
+void oledC_DrawCharacterOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint16_t background)
+{
+    oledc_window_stats_t before, after;
+
+    textStats.glyphs = 0;
+    textStats.pixels = 0;
+    oledC_getWindowStats(&before);
+    drawGlyphOpaque(x, y, sx, sy, ch, color, background, false);
+    oledC_getWindowStats(&after);
+    textStats.commands = (after.misses - before.misses) + textStats.glyphs;
+}
+
+/* Like oledC_DrawString(), but the gaps between glyphs are painted too */
+void oledC_DrawStringOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color, uint16_t background)
+{
+    oledc_window_stats_t before, after;
+
+    textStats.glyphs = 0;
+    textStats.pixels = 0;
+    oledC_getWindowStats(&before);
+    while(*string)
+    {
+        drawGlyphOpaque(x, y, sx, sy, *string, color, background, string[1] != '\0');
+        string++;
+        x += OLED_FONT_WIDTH * sx + 1;
+    }
+    oledC_getWindowStats(&after);
+    textStats.commands = (after.misses - before.misses) + textStats.glyphs;
+}
+
+void oledC_getTextStats(oledc_text_stats_t *stats)
+{
+    *stats = textStats;
+}
+
+/*
+ * The legacy layout puts the row's MSB at x + sx. Like the old per-pixel
+ * loop, positions past 255 wrap round to the left edge of the panel.
+ */
+static int16_t legacyBitmapX(uint8_t x, uint8_t sx)
+{
+    int16_t start = x + sx;
+    return start + 32 * sx - 1 > 0xFF ? start - 0x100 : start;
+}
+
+uint32_t oledC_bitmapRow(const oledc_bitmap_t *bitmap, uint8_t row)
+{
+    uint32_t bits;
+    if(bitmap->format == OLEDC_BITMAP_ROW16)
+    {
+        bits = (uint32_t)((const uint16_t *)bitmap->rows)[row] << 16;
+    }
+    else
+    {
+        bits = ((const uint32_t *)bitmap->rows)[row];
+    }
+    return bitmap->inverted ? ~bits : bits;
+}
+
+/* Number of equal pixels from col on; ink tells which kind they are */
+static uint8_t bitmapRun(uint32_t bits, uint8_t col, uint8_t width, bool *ink)
+{
+    uint8_t end = col + 1;
+    bits <<= col;
+    *ink = (bits & 0x80000000UL) != 0;
+    while(end < width && ((bits << (end - col)) & 0x80000000UL) == (bits & 0x80000000UL))
+    {
+        end++;
+    }
+    return end - col;
+}
+
+/* One source row as spans covering panel rows ys..ye */
+static void drawBitmapSpans(int16_t x, int16_t ys, int16_t ye, uint32_t bits, uint8_t width,
+    uint8_t sx, uint16_t color, uint16_t background, bool transparent)
+{
+    uint8_t col = 0, run;
+    bool ink;
+
+    width = width > 32 ? 32 : width;
+    while(col < width && x + col * sx <= OLED_DIM_WIDTH)
+    {
+        run = bitmapRun(bits, col, width, &ink);
+        if(ink || !transparent)
+        {
+            fillSpan(x + col * sx, ys, x + (col + run) * sx - 1, ye, ink ? color : background);
+        }
+        col += run;
+    }
+}
+
 void oledC_DrawBitmap(uint8_t x, uint8_t y, uint16_t color, uint8_t sx, uint8_t sy, uint32_t *bitmap, uint8_t bitmap_length)
 {
-    const uint8_t bitmap_width = 32;
     uint8_t rowNum;
-    uint8_t bitNum;
+    int16_t curr_y;
     sx = sx == 0 ? 1 : sx;
     sy = sy == 0 ? 1 : sy;
     for(rowNum = 0; rowNum < bitmap_length; rowNum++)
     {
-        uint32_t rowBits = *bitmap++;
-        uint8_t curr_y = y + rowNum*sy;
-        for(bitNum = 0; bitNum < bitmap_width; bitNum++)
+        curr_y = y + rowNum * sy;
+        if(curr_y > OLED_DIM_HEIGHT)
+        {
+            break;
+        }
+        /* Clear bits are drawn, set bits left alone */
+        drawBitmapSpans(legacyBitmapX(x, sx), curr_y, curr_y + sy - 1, ~bitmap[rowNum], 32, sx, color, 0, true);
+    }
+}
+
+void oledC_DrawPackedBitmap(uint8_t x, uint8_t y, const oledc_bitmap_t *bitmap, uint8_t sx, uint8_t sy, uint16_t color, uint16_t background, bool transparent)
+{
+    uint8_t row, line, col, run;
+    int16_t curr_y, left, count;
+    uint32_t bits;
+    bool ink;
+    oledc_rect_t window;
+
+    sx = sx == 0 ? 1 : sx;
+    sy = sy == 0 ? 1 : sy;
+    if(x > OLED_DIM_WIDTH || y > OLED_DIM_HEIGHT || bitmap->width == 0 || bitmap->height == 0)
+    {
+        return;
+    }
+    if(transparent || target != NULL
+        || !oledC_clipWindow(x, y, (uint16_t)bitmap->width * sx, (uint16_t)bitmap->height * sy, &window))
+    {
+        for(row = 0; row < bitmap->height; row++)
         {
-            if(!(rowBits & 0x01))
+            curr_y = y + row * sy;
+            if(curr_y > OLED_DIM_HEIGHT)
             {
-                uint8_t curr_x = x + (bitmap_width - bitNum)*sx;
-                oledC_DrawRectangle(curr_x, curr_y, curr_x+sx-1, curr_y+sy-1, color);
+                break;
+            }
+            drawBitmapSpans(x, curr_y, curr_y + sy - 1, oledC_bitmapRow(bitmap, row), bitmap->width,
+                sx, color, background, transparent);
+        }
+        return;
+    }
+
+    /* One window for the visible box, filled row by row with colour runs */
+    oledC_beginWindow(window.xs, window.ys, window.xe, window.ye);
+    curr_y = window.ys;
+    for(row = 0; row < bitmap->height && curr_y <= window.ye; row++)
+    {
+        bits = oledC_bitmapRow(bitmap, row);
+        for(line = 0; line < sy && curr_y <= window.ye; line++, curr_y++)
+        {
+            left = window.xe - window.xs + 1;
+            for(col = 0; col < bitmap->width && left > 0; col += run)
+            {
+                run = bitmapRun(bits, col, bitmap->width, &ink);
+                count = run * sx < left ? run * sx : left;
+                oledC_pushRepeat(ink ? color : background, count);
+                left -= count;
             }
-            rowBits >>= 0x000001;
         }
     }
+    oledC_endWindow();
 }
 
 /* Standardized Shape Drawing */
@@ -388,6 +1281,19 @@ static void drawRing(shape_t *shape)
     );
 }
 
+static void drawArc(shape_t *shape)
+{
+    oledC_DrawArc(
+        shape->params.arc.x0, 
+        shape->params.arc.y0, 
+        shape->params.arc.radius, 
+        shape->params.arc.width, 
+        shape->params.arc.start, 
+        shape->params.arc.end, 
+        shape->params.arc.color
+    );
+}
+
 static void drawRectangle(shape_t *shape)
 {
     oledC_DrawRectangle(
@@ -431,7 +1337,8 @@ static void drawString(shape_t *shape)
         shape->params.string.scale_x, 
         shape->params.string.scale_y, 
         shape->params.string.string, 
-        shape->params.string.color
+        shape->params.string.color,
+        shape->params.string.font
     );
 }
 
@@ -447,3 +1354,38 @@ static void drawBitmap(shape_t *shape)
         shape->params.bitmap.array_length
     );
 }
+
+static void drawPackedBitmap(shape_t *shape)
+{
+    oledC_DrawPackedBitmap(
+        shape->params.packedBitmap.x, 
+        shape->params.packedBitmap.y,
+        shape->params.packedBitmap.bitmap,
+        shape->params.packedBitmap.sx,
+        shape->params.packedBitmap.sy,
+        shape->params.packedBitmap.color,
+        shape->params.packedBitmap.background,
+        shape->params.packedBitmap.transparent
+    );
+}
+
+static void drawPoints(shape_t *shape)
+{
+    oledC_DrawPoints(
+        shape->params.points.x,
+        shape->params.points.y,
+        shape->params.points.count,
+        shape->params.points.color
+    );
+}
+
+static void drawPolyline(shape_t *shape)
+{
+    oledC_DrawPolyline(
+        shape->params.polyline.x,
+        shape->params.polyline.y,
+        shape->params.polyline.count,
+        shape->params.polyline.width,
+        shape->params.polyline.color
+    );
+}
@@ -25,6 +25,11 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include "oledC_fonts.h"
+
+/* Last column and row of the panel */
+#define OLED_DIM_WIDTH 0x5F
+#define OLED_DIM_HEIGHT 0x5F
 
 enum OLEDC_SHAPE 
 {
@@ -36,8 +41,28 @@ enum OLEDC_SHAPE
     OLED_SHAPE_CHARACTER,
     OLED_SHAPE_STRING,
     OLED_SHAPE_BITMAP,
+    OLED_SHAPE_POINTS,
+    OLED_SHAPE_POLYLINE,
+    OLED_SHAPE_ARC,
+    OLED_SHAPE_PACKED_BITMAP,
 };
 
+enum OLEDC_BITMAP_FORMAT
+{
+    OLEDC_BITMAP_ROW16,
+    OLEDC_BITMAP_ROW32,
+};
+
+/* 1-bpp image, one word per row with the most significant bit leftmost */
+typedef struct oledc_bitmap_t
+{
+    const void *rows;       /* uint16_t or uint32_t per row, see format */
+    uint8_t format;         /* enum OLEDC_BITMAP_FORMAT */
+    uint8_t width;          /* pixels used per row, counted from the MSB */
+    uint8_t height;
+    bool inverted;          /* clear bits are ink */
+} oledc_bitmap_t;
+
 typedef union shape_params_t 
 {
     struct 
@@ -62,6 +87,16 @@ typedef union shape_params_t
         uint8_t width;
     } ring;
     struct 
+    {
+        uint16_t color;
+        uint8_t x0;
+        uint8_t y0;
+        uint8_t radius;
+        uint8_t width;
+        uint16_t start;
+        uint16_t end;
+    } arc;
+    struct 
     {
         uint16_t color;
         uint8_t xs;
@@ -95,6 +130,7 @@ typedef union shape_params_t
         uint8_t scale_x;
         uint8_t scale_y;
         uint8_t *string;
+        const oledc_font_t *font;   /* NULL = built-in 5x8 font, scaled */
     } string;
     struct 
     {
@@ -106,27 +142,135 @@ typedef union shape_params_t
         uint32_t *bit_array;
         uint8_t array_length;
     } bitmap;
+    struct 
+    {
+        uint16_t color;
+        uint16_t background;
+        uint8_t x;
+        uint8_t y;
+        uint8_t sx;
+        uint8_t sy;
+        const oledc_bitmap_t *bitmap;
+        bool transparent;
+    } packedBitmap;
+    struct 
+    {
+        uint16_t color;
+        uint8_t *x;
+        uint8_t *y;
+        uint8_t count;
+    } points;
+    struct 
+    {
+        uint16_t color;
+        uint8_t *x;
+        uint8_t *y;
+        uint8_t count;
+        uint8_t width;
+    } polyline;
 } shape_params_t;
 
+/* Inclusive panel rectangle */
+typedef struct oledc_rect_t
+{
+    uint8_t xs;
+    uint8_t ys;
+    uint8_t xe;
+    uint8_t ye;
+} oledc_rect_t;
+
+/* Where primitives end up; every shape reduces to clipped fills */
+typedef struct oledc_target_t
+{
+    void (*fillRect)(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+} oledc_target_t;
+
+/* Cost of the last opaque text call */
+typedef struct oledc_text_stats_t
+{
+    uint16_t glyphs;    /* windows opened, one per glyph cell */
+    uint16_t pixels;    /* pixels streamed */
+    uint16_t commands;  /* bound and write commands sent */
+} oledc_text_stats_t;
+
 typedef struct shape 
 {
     uint8_t _type;
     void (*draw)(struct shape*);
     shape_params_t params;
     bool active;
+    /* Kept by the shape handler */
+    oledc_rect_t bounds;    /* cached oledC_getShapeBounds() */
+    bool onScreen;          /* bounds hold something visible */
+    bool hidden;            /* erased, skipped until redrawn */
+    uint8_t below;          /* z-order neighbours, slot numbers */
+    uint8_t above;
 } shape_t;
 
+/* Clip rectangles that can be pushed on top of the whole panel */
+#define OLEDC_CLIP_DEPTH 4
+
+const oledc_target_t *oledC_setTarget(const oledc_target_t *target);
+const oledc_target_t *oledC_getTarget(void);
+/* A panel rectangle straight to the target or the panel, no viewport or clip */
+void oledC_fillPanelRect(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
+
+/*
+ * Every primitive takes coordinates relative to the current viewport and
+ * draws only inside the current clip rectangle. Both nest: a push narrows
+ * the clip to its intersection with the one below. They return false,
+ * having pushed nothing, when the stack is full. Renderers that take
+ * panel rectangles (scanline, shadow, shape handler regions) expect an
+ * empty stack.
+ */
+bool oledC_pushClip(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
+/* Clips to the box and moves (0, 0) to its top-left corner */
+bool oledC_pushViewport(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+void oledC_popClip(void);
+/* Frames pushed and not popped yet; 0 means panel coordinates */
+uint8_t oledC_clipDepth(void);
+/*
+ * For primitives that open a window: the visible part of a box in panel
+ * coordinates. False when its top-left pixel is clipped, as a window
+ * cannot skip columns on the left; draw through rectangles then.
+ */
+bool oledC_clipWindow(uint8_t x, uint8_t y, uint16_t width, uint16_t height, oledc_rect_t *window);
+
 void oledC_createShape(enum OLEDC_SHAPE shape_type, shape_params_t *params, shape_t *newShape);
+bool oledC_getShapeBounds(shape_t *shape, oledc_rect_t *bounds);
+void oledC_drawShapeRow(shape_t *shape, uint8_t row);
 
 void oledC_DrawCircle(uint8_t center_x, uint8_t center_y, uint8_t radius, uint16_t color);
 void oledC_DrawRing(uint8_t center_x, uint8_t center_y, uint8_t radius, uint8_t width, uint16_t color);
+/*
+ * Part of a ring, in degrees clockwise from 12 o'clock. The arc covers
+ * [start, end): arcs that share an end angle meet without a gap or an
+ * overlapping pixel. An end below start wraps through 12 o'clock and
+ * end >= start + 360 draws the whole ring.
+ */
+void oledC_DrawArc(uint8_t center_x, uint8_t center_y, uint8_t radius, uint8_t width, uint16_t start_angle, uint16_t end_angle, uint16_t color);
 void oledC_DrawRectangle(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color);
 void oledC_DrawLine(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint8_t width, uint16_t color);
 void oledC_DrawPoint(uint8_t x, uint8_t y, uint16_t color);
+/* Sorted by panel address first, with neighbours on a row sent as one run */
+void oledC_DrawPoints(const uint8_t *x, const uint8_t *y, uint8_t count, uint16_t color);
+/* Connects the points in order with lines of the given width */
+void oledC_DrawPolyline(const uint8_t *x, const uint8_t *y, uint8_t count, uint8_t width, uint16_t color);
 uint16_t oledC_ReadPoint(uint8_t x, uint8_t y);
 void oledC_DrawThickPoint(uint8_t center_x, uint8_t center_y, uint8_t width, uint16_t color);
 void oledC_DrawCharacter(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color);
-void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color);
+/* With a font the glyphs are drawn at its native size and sx/sy are ignored */
+void oledC_DrawString(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color, const oledc_font_t *font);
+void oledC_DrawCharacterOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t ch, uint16_t color, uint16_t background);
+void oledC_DrawStringOpaque(uint8_t x, uint8_t y, uint8_t sx, uint8_t sy, uint8_t *string, uint16_t color, uint16_t background);
+void oledC_getTextStats(oledc_text_stats_t *stats);
 void oledC_DrawBitmap(uint8_t x, uint8_t y, uint16_t color, uint8_t sx, uint8_t sy, uint32_t *bit_array, uint8_t array_width);
+/* Row bits with the leftmost pixel in bit 31 and ink bits set */
+uint32_t oledC_bitmapRow(const oledc_bitmap_t *bitmap, uint8_t row);
+/*
+ * Opaque bitmaps go out as one window of ink and background pixels;
+ * transparent ones (or any bitmap while a target is set) as row spans.
+ */
+void oledC_DrawPackedBitmap(uint8_t x, uint8_t y, const oledc_bitmap_t *bitmap, uint8_t sx, uint8_t sy, uint16_t color, uint16_t background, bool transparent);
 
 #endif	/* OLEDC_SHAPES_H */
@@ -0,0 +1,242 @@
+/*
+ * File:   oledC_sprite.c
+ *
+ * Changes are worked out in bands of panel rows that map to one frame row
+ * of both the old and the new placement. Each frame row becomes a list of
+ * ink edges; walking the two lists together gives the spans where old and
+ * new disagree, and only those are painted.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "oledC_shapes.h"
+#include "oledC_sprite.h"
+
+/* A 32-pixel row has at most 16 ink runs */
+#define SPRITE_MAX_EDGES 32
+
+static void paint(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y, uint16_t color);
+static uint8_t inkEdges(const oledc_bitmap_t *bitmap, uint8_t row, int16_t x, uint8_t scale, int16_t *edges);
+static void paintDifference(const int16_t *oldEdges, uint8_t oldCount, const int16_t *newEdges, uint8_t newCount,
+    int16_t start_y, int16_t end_y, uint16_t color, uint16_t background);
+static void drawDifference(const oledc_sprite_t *sprite, bool show, uint8_t x, uint8_t y, uint8_t frame);
+static void drawDelta(const oledc_sprite_t *sprite, const oledc_bitmap_t *delta, uint8_t frame);
+
+void oledC_spriteInit(oledc_sprite_t *sprite, const oledc_bitmap_t *frames, uint8_t frame_count, const oledc_bitmap_t *deltas, uint8_t scale, uint16_t color, uint16_t background)
+{
+    sprite->frames = frames;
+    sprite->deltas = deltas;
+    sprite->frameCount = frame_count;
+    sprite->scale = scale == 0 ? 1 : scale;
+    sprite->color = color;
+    sprite->background = background;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->frame = 0;
+    sprite->shown = false;
+}
+
+void oledC_spriteInvalidate(oledc_sprite_t *sprite)
+{
+    sprite->shown = false;
+}
+
+bool oledC_spriteShow(oledc_sprite_t *sprite, uint8_t x, uint8_t y, uint8_t frame)
+{
+    const oledc_bitmap_t *delta = NULL;
+
+    if(frame >= sprite->frameCount)
+    {
+        return false;
+    }
+    if(sprite->shown && sprite->x == x && sprite->y == y)
+    {
+        if(sprite->frame == frame)
+        {
+            return false;
+        }
+        if(sprite->deltas != NULL && (sprite->frame + 1) % sprite->frameCount == frame)
+        {
+            delta = &sprite->deltas[sprite->frame];
+        }
+        else if(sprite->deltas != NULL && (frame + 1) % sprite->frameCount == sprite->frame)
+        {
+            delta = &sprite->deltas[frame];
+        }
+    }
+    if(delta != NULL)
+    {
+        drawDelta(sprite, delta, frame);
+    }
+    else
+    {
+        drawDifference(sprite, true, x, y, frame);
+    }
+    sprite->x = x;
+    sprite->y = y;
+    sprite->frame = frame;
+    sprite->shown = true;
+    return true;
+}
+
+bool oledC_spriteHide(oledc_sprite_t *sprite)
+{
+    if(!sprite->shown)
+    {
+        return false;
+    }
+    drawDifference(sprite, false, 0, 0, 0);
+    sprite->shown = false;
+    return true;
+}
+
+static void paint(int16_t start_x, int16_t start_y, int16_t end_x, int16_t end_y, uint16_t color)
+{
+    if(end_x < 0 || start_x > OLED_DIM_WIDTH || start_y > OLED_DIM_HEIGHT || start_x > end_x)
+    {
+        return;
+    }
+    oledC_DrawRectangle(start_x < 0 ? 0 : start_x, start_y, end_x, end_y, color);
+}
+
+/* Panel columns where the ink of one frame row starts and stops */
+static uint8_t inkEdges(const oledc_bitmap_t *bitmap, uint8_t row, int16_t x, uint8_t scale, int16_t *edges)
+{
+    uint32_t bits = oledC_bitmapRow(bitmap, row);
+    uint8_t col, count = 0;
+    bool inInk = false, ink;
+
+    for(col = 0; col < bitmap->width && col < 32; col++)
+    {
+        ink = ((bits << col) & 0x80000000UL) != 0;
+        if(ink != inInk)
+        {
+            edges[count++] = x + col * scale;
+            inInk = ink;
+        }
+    }
+    if(inInk)
+    {
+        edges[count++] = x + col * scale;
+    }
+    return count;
+}
+
+static void paintDifference(const int16_t *oldEdges, uint8_t oldCount, const int16_t *newEdges, uint8_t newCount,
+    int16_t start_y, int16_t end_y, uint16_t color, uint16_t background)
+{
+    uint8_t i = 0, j = 0;
+    bool oldInk = false, newInk = false;
+    int16_t last = 0, at;
+
+    while(i < oldCount || j < newCount)
+    {
+        at = (j >= newCount || (i < oldCount && oldEdges[i] < newEdges[j])) ? oldEdges[i] : newEdges[j];
+        if(oldInk != newInk)
+        {
+            paint(last, start_y, at - 1, end_y, newInk ? color : background);
+        }
+        while(i < oldCount && oldEdges[i] == at)
+        {
+            oldInk = !oldInk;
+            i++;
+        }
+        while(j < newCount && newEdges[j] == at)
+        {
+            newInk = !newInk;
+            j++;
+        }
+        last = at;
+    }
+}
+
+/* Old placement (if shown) against the new one (if show) */
+static void drawDifference(const oledc_sprite_t *sprite, bool show, uint8_t x, uint8_t y, uint8_t frame)
+{
+    int16_t oldEdges[SPRITE_MAX_EDGES], newEdges[SPRITE_MAX_EDGES];
+    int16_t height = sprite->frames[0].height * sprite->scale;
+    int16_t top = 0x7FFF, bottom = -1, row, end, src;
+    uint8_t oldCount, newCount;
+
+    if(sprite->shown)
+    {
+        top = sprite->y;
+        bottom = sprite->y + height;
+    }
+    if(show)
+    {
+        top = y < top ? y : top;
+        bottom = y + height > bottom ? y + height : bottom;
+    }
+    for(row = top; row < bottom && row <= OLED_DIM_HEIGHT; row = end)
+    {
+        end = bottom;
+        oldCount = 0;
+        newCount = 0;
+        if(sprite->shown && row < sprite->y)
+        {
+            end = sprite->y < end ? sprite->y : end;
+        }
+        else if(sprite->shown && row < sprite->y + height)
+        {
+            src = (row - sprite->y) / sprite->scale;
+            end = sprite->y + (src + 1) * sprite->scale < end ? sprite->y + (src + 1) * sprite->scale : end;
+            oldCount = inkEdges(&sprite->frames[sprite->frame], src, sprite->x, sprite->scale, oldEdges);
+        }
+        if(show && row < y)
+        {
+            end = y < end ? y : end;
+        }
+        else if(show && row < y + height)
+        {
+            src = (row - y) / sprite->scale;
+            end = y + (src + 1) * sprite->scale < end ? y + (src + 1) * sprite->scale : end;
+            newCount = inkEdges(&sprite->frames[frame], src, x, sprite->scale, newEdges);
+        }
+        paintDifference(oldEdges, oldCount, newEdges, newCount, row, end - 1, sprite->color, sprite->background);
+    }
+}
+
+/* Same place, next or previous frame: only the pixels set in the delta */
+static void drawDelta(const oledc_sprite_t *sprite, const oledc_bitmap_t *delta, uint8_t frame)
+{
+    const oledc_bitmap_t *bitmap = &sprite->frames[frame];
+    uint8_t scale = sprite->scale;
+    uint8_t row, col, start;
+    uint32_t changed, ink, bit;
+    int16_t curr_y;
+
+    for(row = 0; row < bitmap->height; row++)
+    {
+        changed = oledC_bitmapRow(delta, row);
+        curr_y = sprite->y + row * scale;
+        if(changed == 0)
+        {
+            continue;
+        }
+        if(curr_y > OLED_DIM_HEIGHT)
+        {
+            break;
+        }
+        ink = oledC_bitmapRow(bitmap, row);
+        col = 0;
+        while(col < bitmap->width && col < 32)
+        {
+            if(!((changed << col) & 0x80000000UL))
+            {
+                col++;
+                continue;
+            }
+            start = col;
+            bit = (ink << col) & 0x80000000UL;
+            do
+            {
+                col++;
+            } while(col < bitmap->width && col < 32 && ((changed << col) & 0x80000000UL)
+                && ((ink << col) & 0x80000000UL) == bit);
+            paint(sprite->x + start * scale, curr_y, sprite->x + col * scale - 1, curr_y + scale - 1,
+                bit ? sprite->color : sprite->background);
+        }
+    }
+}
@@ -0,0 +1,38 @@
+/*
+ * File:   oledC_sprite.h
+ *
+ * 1-bpp sprites on a plain background. A sprite remembers where it is
+ * and which frame the panel shows, and on every change paints only the
+ * pixels that differ: the strips a move uncovers or newly covers, or the
+ * XOR delta between two animation frames.
+ */
+
+#ifndef OLEDC_SPRITE_H
+#define	OLEDC_SPRITE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "oledC_shapes.h"
+
+typedef struct oledc_sprite_t
+{
+    const oledc_bitmap_t *frames;   /* all frames the same size and format */
+    const oledc_bitmap_t *deltas;   /* optional, deltas[i] = frames[i] ^ frames[i + 1], wrapping */
+    uint8_t frameCount;
+    uint8_t scale;
+    uint16_t color;
+    uint16_t background;
+    uint8_t x;          /* what the panel shows */
+    uint8_t y;
+    uint8_t frame;
+    bool shown;
+} oledc_sprite_t;
+
+void oledC_spriteInit(oledc_sprite_t *sprite, const oledc_bitmap_t *frames, uint8_t frame_count, const oledc_bitmap_t *deltas, uint8_t scale, uint16_t color, uint16_t background);
+/* The panel under the sprite is plain background again, e.g. after a clear */
+void oledC_spriteInvalidate(oledc_sprite_t *sprite);
+/* Both return false, having drawn nothing, when the panel already matches */
+bool oledC_spriteShow(oledc_sprite_t *sprite, uint8_t x, uint8_t y, uint8_t frame);
+bool oledC_spriteHide(oledc_sprite_t *sprite);
+
+#endif	/* OLEDC_SPRITE_H */
@@ -35,21 +35,35 @@ void spi1_close(void)
     SPI1CON1Lbits.SPIEN = 0;
 }
 
-//con == SPIxCONL, brg == SPIxBRGL, operation == Master/Slave
-typedef struct { uint16_t con1; uint16_t brg; uint8_t operation;} spi1_configuration_t;
-static const spi1_configuration_t spi1_configuration[] = {   
-    { 0x0120, 0x0000, 0 },
-    { 0x0120, 0x000F, 0 }
-};
-
 bool spi1_open(/*spi1_modes spiUniqueConfiguration*/)
 {
     if(!SPI1CON1Lbits.SPIEN)
     {
-        SPI1CON1L = 0x0120;//spi1_configuration[spiUniqueConfiguration].con1;
-        SPI1BRGL = 0;//spi1_configuration[spiUniqueConfiguration].brg;
+        SPI1CON1L = 0x0121; // CKE, MSTEN, ENHBUF
+        SPI1CON1H = 0x2000; // IGNROV: write-only traffic may leave the RX FIFO full
+        SPI1BRGL = 0;
+        
+        TRISBbits.TRISB15 = 0;
+        SPI1CON1Lbits.SPIEN = 1;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Transmit-only 16-bit mode: MODE16 + ENHBUF gives an 8-word TX FIFO, so a
+ * RGB565 pixel is one SPI1BUFL write and the CPU only stalls while the FIFO
+ * is full. MODE16 can only change while SPIEN = 0, hence the separate open.
+ */
+bool spi1_openWordWriter(void)
+{
+    if(!SPI1CON1Lbits.SPIEN)
+    {
+        SPI1CON1L = 0x0521; // MODE16, CKE, MSTEN, ENHBUF
+        SPI1CON1H = 0x2000; // IGNROV
+        SPI1BRGL = 0;
         
-        TRISBbits.TRISB15 = 0;//spi1_configuration[spiUniqueConfiguration].operation;
+        TRISBbits.TRISB15 = 0;
         SPI1CON1Lbits.SPIEN = 1;
         return true;
     }
@@ -60,7 +74,7 @@ bool spi1_open(/*spi1_modes spiUniqueConfiguration*/)
 uint8_t spi1_exchangeByte(uint8_t b)
 {
     SPI1BUFL = b;
-    while(!SPI1STATLbits.SPIRBF);
+    while(SPI1STATLbits.SPIRBE);
     return SPI1BUFL;
 }
 
@@ -80,7 +94,117 @@ void spi1_writeBlock(void *block, size_t blockSize)
     uint8_t *data = block;
     while(blockSize--)
     {
-        spi1_exchangeByte(*data++);
+        while(SPI1STATLbits.SPITBF);
+        SPI1BUFL = *data++;
+    }
+    spi1_drain();
+}
+
+/* Word writes need spi1_openWordWriter(); finish with spi1_drain(). */
+void spi1_writeWord(uint16_t word)
+{
+    while(SPI1STATLbits.SPITBF);
+    SPI1BUFL = word;
+}
+
+void spi1_writeWordBlock(const uint16_t *block, size_t blockSize)
+{
+    while(blockSize--)
+    {
+        while(SPI1STATLbits.SPITBF);
+        SPI1BUFL = *block++;
+    }
+}
+
+void spi1_writeWordRepeat(uint16_t word, size_t count)
+{
+    while(count--)
+    {
+        while(SPI1STATLbits.SPITBF);
+        SPI1BUFL = word;
+    }
+}
+
+/*
+ * Waits until the FIFO and shift register are empty, so chip select can be
+ * released, then throws away whatever write-only traffic clocked in.
+ */
+void spi1_drain(void)
+{
+    while(!SPI1STATLbits.SPITBE);
+    while(!SPI1STATLbits.SRMT);
+    while(!SPI1STATLbits.SPIRBE)
+    {
+        (void)SPI1BUFL;
+    }
+    SPI1STATLbits.SPIROV = 0;
+}
+
+/*
+ * DMA0 feeds SPI1BUFL one word per SPI1 transmit event, so a whole pixel
+ * run goes out without the CPU. With SPITBEN the event is the TX FIFO
+ * draining to empty, so each one-shot transfer refills it by one word and
+ * it can never overflow. The FIFO is already empty here, so the first word
+ * is written by hand; its move into the shift register raises the first
+ * event. The source must be in data RAM (0x0800-0x47FF): DMA0 cannot read
+ * const data through PSV. The bus must already be open through
+ * spi1_openWordWriter(); completion is reported through the handler set
+ * with spi1_setSpiISR(), from the DMA0 interrupt, once the last word is in
+ * the FIFO.
+ */
+#define SPI1_DMA_TX_TRIGGER 0x0B /* SPI1 transmit event (DMA trigger table) */
+
+static volatile bool dmaBusy = false;
+
+bool spi1_dmaWriteWords(const uint16_t *source, size_t count, bool incrementSource)
+{
+    if(dmaBusy || count < 2 || !SPI1CON1Lbits.SPIEN || !SPI1CON1Lbits.MODE16)
+    {
+        return false;
+    }
+    dmaBusy = true;
+    SPI1IMSKLbits.SPITBEN = 1;
+    DMACONbits.DMAEN = 1;
+    DMAL = 0x0800; /* data RAM */
+    DMAH = 0x47FF;
+    DMACH0 = 0;
+    DMACH0bits.SIZE = 0;        /* word transfers */
+    DMACH0bits.TRMODE = 0;      /* one-shot: one word per trigger until DMACNT0 = 0 */
+    DMACH0bits.SAMODE = incrementSource ? 1 : 0;
+    DMACH0bits.DAMODE = 0;      /* always SPI1BUFL */
+    DMAINT0 = 0;
+    DMAINT0bits.CHSEL = SPI1_DMA_TX_TRIGGER;
+    DMASRC0 = (uintptr_t)(incrementSource ? source + 1 : source);
+    DMADST0 = (uintptr_t)&SPI1BUFL;
+    DMACNT0 = count - 1;
+    IPC1bits.DMA0IP = 6;        /* above Timer1, which draws from its interrupt */
+    IFS0bits.DMA0IF = 0;
+    IEC0bits.DMA0IE = 1;
+    DMACH0bits.CHEN = 1;
+    SPI1BUFL = *source;
+    return true;
+}
+
+bool spi1_dmaIsBusy(void)
+{
+    return dmaBusy;
+}
+
+void __attribute__((__interrupt__, auto_psv)) _DMA0Interrupt(void)
+{
+    DMAINT0bits.DONEIF = 0;
+    IFS0bits.DMA0IF = 0;
+    if(!dmaBusy)
+    {
+        return;
+    }
+    DMACH0bits.CHEN = 0;
+    IEC0bits.DMA0IE = 0;
+    SPI1IMSKLbits.SPITBEN = 0;
+    dmaBusy = false;
+    if(spi1_interruptHandler)
+    {
+        spi1_interruptHandler();
     }
 }
 
@@ -95,6 +219,7 @@ void spi1_readBlock(void *block, size_t blockSize)
 
 void spi1_writeByte(uint8_t byte)
 {
+    while(SPI1STATLbits.SPITBF);
     SPI1BUFL = byte;
 }
 
@@ -41,6 +41,17 @@ void spi1_exchangeBlock(void *block, size_t blockSize);
 void spi1_writeBlock(void *block, size_t blockSize);
 void spi1_readBlock(void *block, size_t blockSize);
 
+/* Transmit-only 16-bit FIFO writes (display traffic) */
+bool spi1_openWordWriter(void);
+void spi1_writeWord(uint16_t word);
+void spi1_writeWordBlock(const uint16_t *block, size_t blockSize);
+void spi1_writeWordRepeat(uint16_t word, size_t count);
+void spi1_drain(void);
+
+/* DMA0 word transmit from data RAM, count >= 2; completion calls the spi1_setSpiISR() handler */
+bool spi1_dmaWriteWords(const uint16_t *source, size_t count, bool incrementSource);
+bool spi1_dmaIsBusy(void);
+
 void spi1_writeByte(uint8_t byte);
 uint8_t spi1_readByte(void);
 
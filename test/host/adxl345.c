@@ -0,0 +1,422 @@
+/*
+ * File:   adxl345.c
+ *
+ * The ADXL345 registers the firmware uses, behind i2c1_open(),
+ * i2cReadSlaveRegister(s)() and i2cWriteSlave():
+ *  - samples are taken every 1 / ODR while POWER_CTL.Measure is set, with
+ *    ODR = 3200 Hz >> (15 - BW_RATE rate bits);
+ *  - bypass mode keeps the latest sample in DATAX0..DATAZ1; FIFO and
+ *    stream mode queue up to 32, stream mode dropping the oldest once
+ *    full. Writing bypass mode to FIFO_CTL empties the FIFO;
+ *  - activity compares each sample with a reference taken when activity
+ *    detection starts, inactivity needs all axes within THRESH_INACT of
+ *    the last sample that moved for TIME_INACT seconds. Link mode makes
+ *    them alternate, starting with activity;
+ *  - a tap is a run of samples above THRESH_TAP shorter than DUR; a second
+ *    one that ends after LATENT and within WINDOW is a double tap.
+ * Every FIFO entry remembers the rate it was taken at, so reads of samples
+ * left over from another rate show up in adxlStats.staleReads.
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "adxl345.h"
+#include "Accel_i2c.h"
+
+#define DEVICE_ADDRESS 0x3A
+#define DEVICE_ID 0xE5
+#define BIT_US 10u         /* 100 kHz */
+#define BYTE_US (9u * BIT_US)
+
+#define REG_DEVID 0x00
+#define REG_THRESH_TAP 0x1D
+#define REG_DUR 0x21
+#define REG_LATENT 0x22
+#define REG_WINDOW 0x23
+#define REG_THRESH_ACT 0x24
+#define REG_THRESH_INACT 0x25
+#define REG_TIME_INACT 0x26
+#define REG_ACT_INACT_CTL 0x27
+#define REG_TAP_AXES 0x2A
+#define REG_BW_RATE 0x2C
+#define REG_POWER_CTL 0x2D
+#define REG_INT_ENABLE 0x2E
+#define REG_INT_SOURCE 0x30
+#define REG_DATAX0 0x32
+#define REG_DATAZ1 0x37
+#define REG_FIFO_CTL 0x38
+#define REG_FIFO_STATUS 0x39
+#define REG_COUNT 0x40
+
+#define RATE_MASK 0x0F
+#define MEASURE 0x08
+#define LINK 0x20
+#define INT_DATA_READY 0x80
+#define INT_SINGLE_TAP 0x40
+#define INT_DOUBLE_TAP 0x20
+#define INT_ACTIVITY 0x10
+#define INT_INACTIVITY 0x08
+#define INT_WATERMARK 0x02
+#define INT_OVERRUN 0x01
+#define INT_CLEARED_BY_READ (INT_SINGLE_TAP | INT_DOUBLE_TAP | INT_ACTIVITY | INT_INACTIVITY)
+#define FIFO_BYPASS 0
+#define FIFO_FIFO 1
+
+typedef struct
+{
+    adxl_sample_t sample;
+    uint8_t rate;
+} entry_t;
+
+adxl_model_stats_t adxlStats;
+
+static const adxl_sample_t zero = { 0, 0, 0 };
+
+static uint8_t reg[REG_COUNT];
+static entry_t fifo[ADXL_FIFO_DEPTH];
+static uint8_t fifoCount;
+static entry_t latest;         /* the data registers in bypass mode */
+static bool latestUnread;
+static adxl_source_t source;
+static uint32_t now;
+static uint32_t nextSample;
+
+static bool referenced;
+static bool waitingForActivity;
+static adxl_sample_t activityReference;
+static adxl_sample_t inactivityReference;
+static uint32_t stillUs;
+
+static uint8_t tapRun;         /* samples above THRESH_TAP so far */
+static bool firstTapOpen;
+static uint32_t firstTapEnd;
+
+static adxl_sample_t resting(uint32_t us)
+{
+    adxl_sample_t s = { 0, 0, 256 };
+
+    (void)us;
+    return s;
+}
+
+static uint8_t fifoMode(void)
+{
+    return reg[REG_FIFO_CTL] >> 6;
+}
+
+static uint32_t samplePeriod(void)
+{
+    return (625u << (15 - (reg[REG_BW_RATE] & RATE_MASK))) / 2;
+}
+
+/* Any enabled axis more than threshold (62.5 mg/LSB) away from reference */
+static bool beyond(const adxl_sample_t *s, const adxl_sample_t *reference, uint8_t threshold, uint8_t axes)
+{
+    int32_t limit = threshold * 125 / 8;
+
+    return ((axes & 4) && abs(s->x - reference->x) > limit)
+        || ((axes & 2) && abs(s->y - reference->y) > limit)
+        || ((axes & 1) && abs(s->z - reference->z) > limit);
+}
+
+static void raise(uint8_t event)
+{
+    if(reg[REG_INT_ENABLE] & event)
+    {
+        reg[REG_INT_SOURCE] |= event;
+    }
+}
+
+static void detectActivity(const adxl_sample_t *s)
+{
+    uint8_t control = reg[REG_ACT_INACT_CTL];
+    bool link = reg[REG_POWER_CTL] & LINK;
+
+    if(!referenced)
+    {
+        activityReference = *s;
+        inactivityReference = *s;
+        stillUs = 0;
+        referenced = true;
+    }
+    if(!link || waitingForActivity)
+    {
+        if(reg[REG_THRESH_ACT] != 0
+           && beyond(s, (control & 0x80) ? &activityReference : &zero, reg[REG_THRESH_ACT], control >> 4))
+        {
+            raise(INT_ACTIVITY);
+            activityReference = *s;
+            inactivityReference = *s;
+            stillUs = 0;
+            waitingForActivity = false;
+        }
+        if(link)
+        {
+            return;
+        }
+    }
+    if(beyond(s, (control & 0x08) ? &inactivityReference : &zero, reg[REG_THRESH_INACT], control))
+    {
+        inactivityReference = *s;
+        stillUs = 0;
+        return;
+    }
+    if(stillUs < reg[REG_TIME_INACT] * 1000000u)
+    {
+        stillUs += samplePeriod();
+        if(stillUs >= reg[REG_TIME_INACT] * 1000000u)
+        {
+            raise(INT_INACTIVITY);
+            activityReference = *s;
+            waitingForActivity = true;
+        }
+    }
+}
+
+static void detectTap(const adxl_sample_t *s)
+{
+    uint32_t since;
+
+    if(reg[REG_THRESH_TAP] != 0 && beyond(s, &zero, reg[REG_THRESH_TAP], reg[REG_TAP_AXES]))
+    {
+        if(tapRun < 255)
+        {
+            tapRun++;
+        }
+        return;
+    }
+    if(tapRun == 0)
+    {
+        return;
+    }
+    /* DUR is 625 us/LSB, LATENT and WINDOW 1.25 ms/LSB */
+    if(reg[REG_DUR] == 0 || tapRun * samplePeriod() > reg[REG_DUR] * 625u)
+    {
+        tapRun = 0;
+        return;
+    }
+    tapRun = 0;
+    since = now - firstTapEnd;
+    if(firstTapOpen && since > reg[REG_LATENT] * 1250u
+       && since <= (reg[REG_LATENT] + reg[REG_WINDOW]) * 1250u)
+    {
+        raise(INT_DOUBLE_TAP);
+        firstTapOpen = false;
+        return;
+    }
+    raise(INT_SINGLE_TAP);
+    firstTapOpen = true;
+    firstTapEnd = now;
+}
+
+static void showData(const entry_t *e)
+{
+    memcpy(&reg[REG_DATAX0], &e->sample, sizeof e->sample);
+}
+
+static void updateStatus(void)
+{
+    uint8_t watermark = reg[REG_FIFO_CTL] & 0x1F;
+
+    reg[REG_FIFO_STATUS] = fifoCount;
+    reg[REG_INT_SOURCE] &= ~(INT_DATA_READY | INT_WATERMARK);
+    if(fifoMode() == FIFO_BYPASS ? latestUnread : fifoCount != 0)
+    {
+        reg[REG_INT_SOURCE] |= INT_DATA_READY;
+    }
+    if(fifoMode() != FIFO_BYPASS && fifoCount >= watermark)
+    {
+        reg[REG_INT_SOURCE] |= INT_WATERMARK;
+    }
+}
+
+static void takeSample(void)
+{
+    entry_t e;
+
+    e.sample = source(now);
+    e.rate = reg[REG_BW_RATE] & RATE_MASK;
+    adxlStats.samples++;
+    detectActivity(&e.sample);
+    detectTap(&e.sample);
+    latest = e;
+    latestUnread = true;
+    if(fifoMode() == FIFO_BYPASS)
+    {
+        showData(&e);
+    }
+    else if(fifoCount < ADXL_FIFO_DEPTH)
+    {
+        fifo[fifoCount++] = e;
+        showData(&fifo[0]);
+    }
+    else if(fifoMode() == FIFO_FIFO)
+    {
+        reg[REG_INT_SOURCE] |= INT_OVERRUN;
+    }
+    else
+    {
+        memmove(fifo, fifo + 1, (ADXL_FIFO_DEPTH - 1) * sizeof fifo[0]);
+        fifo[ADXL_FIFO_DEPTH - 1] = e;
+        showData(&fifo[0]);
+        adxlStats.overruns++;
+        reg[REG_INT_SOURCE] |= INT_OVERRUN;
+    }
+}
+
+void adxl_run(uint32_t us)
+{
+    uint32_t end = now + us;
+
+    while((reg[REG_POWER_CTL] & MEASURE) && nextSample <= end)
+    {
+        now = nextSample;
+        nextSample += samplePeriod();
+        takeSample();
+    }
+    now = end;
+    updateStatus();
+}
+
+/* The data registers were read: hand out one sample and pop it */
+static void readData(void)
+{
+    const entry_t *e = fifoMode() == FIFO_BYPASS ? &latest : &fifo[0];
+
+    adxlStats.dataReads++;
+    if(e->rate != (reg[REG_BW_RATE] & RATE_MASK))
+    {
+        adxlStats.staleReads++;
+    }
+    reg[REG_INT_SOURCE] &= ~INT_OVERRUN;
+    latestUnread = false;
+    if(fifoMode() != FIFO_BYPASS && fifoCount != 0)
+    {
+        memmove(fifo, fifo + 1, --fifoCount * sizeof fifo[0]);
+        if(fifoCount != 0)
+        {
+            showData(&fifo[0]);
+        }
+    }
+}
+
+static void writeRegister(uint8_t address, uint8_t value)
+{
+    uint8_t was = reg[address];
+
+    reg[address] = value;
+    if(address == REG_FIFO_CTL && fifoMode() == FIFO_BYPASS)
+    {
+        fifoCount = 0;
+        showData(&latest);
+    }
+    else if(address == REG_BW_RATE && (was & RATE_MASK) != (value & RATE_MASK))
+    {
+        nextSample = now + samplePeriod();
+    }
+    else if(address == REG_POWER_CTL && (value & MEASURE) && !(was & MEASURE))
+    {
+        referenced = false;
+        waitingForActivity = true;
+        nextSample = now + samplePeriod();
+    }
+    updateStatus();
+}
+
+void adxl_reset(void)
+{
+    memset(&adxlStats, 0, sizeof adxlStats);
+    memset(reg, 0, sizeof reg);
+    reg[REG_DEVID] = DEVICE_ID;
+    reg[REG_BW_RATE] = 0x0A;
+    memset(&latest, 0, sizeof latest);
+    latestUnread = false;
+    fifoCount = 0;
+    source = resting;
+    now = 0;
+    nextSample = 0;
+    referenced = false;
+    waitingForActivity = true;
+    tapRun = 0;
+    firstTapOpen = false;
+    updateStatus();
+}
+
+void adxl_setSource(adxl_source_t newSource)
+{
+    source = newSource;
+}
+
+uint32_t adxl_now(void)
+{
+    return now;
+}
+
+uint8_t adxl_peek(uint8_t address)
+{
+    return reg[address & (REG_COUNT - 1)];
+}
+
+uint8_t adxl_fifoLevel(void)
+{
+    return fifoCount;
+}
+
+void i2c1_open(void)
+{
+}
+
+I2Cerror i2cReadSlaveRegisters(unsigned char devAddW, unsigned char regAdd, unsigned char *buf, unsigned char count)
+{
+    unsigned char n;
+
+    if(devAddW != DEVICE_ADDRESS)
+    {
+        return NACK;
+    }
+    if(regAdd + count > REG_COUNT)
+    {
+        return BAD_REG;
+    }
+    for(n = 0; n < count; n++)
+    {
+        buf[n] = reg[regAdd + n];
+    }
+    if(regAdd <= REG_INT_SOURCE && regAdd + count > REG_INT_SOURCE)
+    {
+        reg[REG_INT_SOURCE] &= ~INT_CLEARED_BY_READ;
+    }
+    if(regAdd <= REG_DATAZ1 && regAdd + count > REG_DATAX0)
+    {
+        readData();
+    }
+    adxlStats.transactions++;
+    adxlStats.reads++;
+    adxlStats.bytes += 3 + count;
+    adxl_run((3 + count) * BYTE_US);
+    return OK;
+}
+
+I2Cerror i2cReadSlaveRegister(unsigned char devAddW, unsigned char regAdd, unsigned char *value)
+{
+    return i2cReadSlaveRegisters(devAddW, regAdd, value, 1);
+}
+
+I2Cerror i2cWriteSlave(unsigned char devAddW, unsigned char regAdd, unsigned char data)
+{
+    if(devAddW != DEVICE_ADDRESS)
+    {
+        return NACK;
+    }
+    if(regAdd >= REG_COUNT)
+    {
+        return BAD_REG;
+    }
+    writeRegister(regAdd, data);
+    adxlStats.transactions++;
+    adxlStats.writes++;
+    adxlStats.bytes += 3;
+    adxl_run(3 * BYTE_US);
+    return OK;
+}
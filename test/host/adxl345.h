@@ -0,0 +1,65 @@
+/*
+ * File:   adxl345.h
+ *
+ * Host model of the ADXL345 behind the Accel_i2c.h calls, for tests that
+ * link it in place of Accel_i2c.c. It keeps the register file and models
+ * the output data rate, the FIFO in bypass and stream mode with its
+ * watermark and overrun, linked activity/inactivity against ac-coupled
+ * references, and single/double tap timing. Reading INT_SOURCE clears the
+ * event bits, and a FIFO entry pops once its data registers are read, as
+ * on the part.
+ *
+ * Time is counted in microseconds. Each transaction moves the sensor clock
+ * on by its time on a 100 kHz bus, 9 bit times per byte: 3 + n bytes for
+ * an n-register read, 3 for a write.
+ */
+
+#ifndef ADXL345_H
+#define ADXL345_H
+
+#include <stdint.h>
+
+#define ADXL_FIFO_DEPTH 32
+
+typedef struct
+{
+    int16_t x, y, z; /* 4 mg/LSB, as in full resolution mode */
+} adxl_sample_t;
+
+/* Acceleration at us microseconds since adxl_reset() */
+typedef adxl_sample_t (*adxl_source_t)(uint32_t us);
+
+typedef struct
+{
+    uint32_t transactions;
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t bytes;      /* on the wire, addresses included */
+    uint32_t samples;    /* taken since measuring started */
+    uint32_t overruns;   /* FIFO entries lost to a full FIFO */
+    uint32_t dataReads;  /* samples read out of the data registers */
+    uint32_t staleReads; /* of those, samples taken at another rate */
+} adxl_model_stats_t;
+
+extern adxl_model_stats_t adxlStats;
+
+/* Power-on register values, an empty FIFO, a resting source and no
+ * statistics. */
+void adxl_reset(void);
+
+/* Sets the acceleration the sensor measures. */
+void adxl_setSource(adxl_source_t source);
+
+/* Lets the sensor sample for us microseconds without any bus traffic. */
+void adxl_run(uint32_t us);
+
+/* Microseconds since adxl_reset(). */
+uint32_t adxl_now(void);
+
+/* A register's value without a read's side effects. */
+uint8_t adxl_peek(uint8_t reg);
+
+/* Samples waiting in the FIFO. */
+uint8_t adxl_fifoLevel(void);
+
+#endif /* ADXL345_H */
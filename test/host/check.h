@@ -0,0 +1,26 @@
+/*
+ * File:   check.h
+ *
+ * Minimal assertions for the host tests: failures are counted and
+ * reported, and CHECK_RESULT() turns them into the exit status.
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+static int checkFailures;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) \
+        { \
+            printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            checkFailures++; \
+        } \
+    } while(0)
+
+#define CHECK_RESULT() (checkFailures != 0)
+
+#endif /* CHECK_H */
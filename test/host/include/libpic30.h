@@ -0,0 +1,13 @@
+/*
+ * File:   libpic30.h
+ *
+ * Host stand-in: delays take no time, the register model keeps the clock.
+ */
+
+#ifndef LIBPIC30_H
+#define LIBPIC30_H
+
+#define __delay_ms(ms) ((void)(ms))
+#define __delay_us(us) ((void)(us))
+
+#endif /* LIBPIC30_H */
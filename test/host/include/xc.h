@@ -0,0 +1,515 @@
+/*
+ * File:   xc.h
+ *
+ * Host stand-in for the XC16 device header. Registers are plain memory,
+ * except SPI1BUFL and SPI1STATL: every access to those runs the SPI1/DMA0
+ * model in sfr_model.c forward in time. The registers the model reads have
+ * their data sheet bit layout; the rest share one loose bit structure.
+ */
+
+#ifndef XC_H
+#define XC_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    unsigned LATA13:1;
+    unsigned LATC1:1;
+    unsigned LATC3:1;
+    unsigned LATC8:1;
+    unsigned LATC9:1;
+    unsigned RA0:1;
+    unsigned RA1:1;
+    unsigned RA11:1;
+    unsigned RA12:1;
+    unsigned TRISA0:1;
+    unsigned TRISA1:1;
+    unsigned TRISB15:1;
+    unsigned ACKDT:1;
+    unsigned ACKEN:1;
+    unsigned I2CEN:1;
+    unsigned PEN:1;
+    unsigned RCEN:1;
+    unsigned RSEN:1;
+    unsigned SEN:1;
+    unsigned ACKSTAT:1;
+    unsigned BCL:1;
+    unsigned TRSTAT:1;
+    unsigned SPI1RXIF:1;
+    unsigned ADDRERR:1;
+    unsigned MATHERR:1;
+    unsigned OSCFAIL:1;
+    unsigned STKERR:1;
+    unsigned SGHT:1;
+    unsigned TCS:1;
+    unsigned TGATE:1;
+    unsigned TON:1;
+    unsigned TCKPS:2;
+    unsigned T1IP:3;
+    unsigned DMA0IP:3;
+    unsigned RP14R:6;
+    unsigned RP15R:6;
+    unsigned SDI1R:6;
+} sfr_bits_t;
+
+typedef union
+{
+    uint16_t w;
+    sfr_bits_t bits;
+} sfr_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned ENHBUF:1;
+        unsigned SPIFE:1;
+        unsigned MCLKEN:1;
+        unsigned DISSCK:1;
+        unsigned DISSDI:1;
+        unsigned MSTEN:1;
+        unsigned CKP:1;
+        unsigned SSEN:1;
+        unsigned CKE:1;
+        unsigned SMP:1;
+        unsigned MODE16:1;
+        unsigned MODE32:1;
+        unsigned DISSDO:1;
+        unsigned SPISIDL:1;
+        unsigned :1;
+        unsigned SPIEN:1;
+    } bits;
+} SPI1CON1L_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned :12;
+        unsigned IGNTUR:1;
+        unsigned IGNROV:1;
+        unsigned :2;
+    } bits;
+} SPI1CON1H_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned SPIRBF:1;
+        unsigned SPITBF:1;
+        unsigned :1;
+        unsigned SPITBE:1;
+        unsigned :1;
+        unsigned SPIRBE:1;
+        unsigned SPIROV:1;
+        unsigned SRMT:1;
+        unsigned SPITUR:1;
+        unsigned :2;
+        unsigned SPIBUSY:1;
+        unsigned FRMERR:1;
+        unsigned :3;
+    } bits;
+} SPI1STATL_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned SPIRBFEN:1;
+        unsigned SPITBFEN:1;
+        unsigned :1;
+        unsigned SPITBEN:1;
+        unsigned :1;
+        unsigned SPIRBEN:1;
+        unsigned SPIROVEN:1;
+        unsigned SRMTEN:1;
+        unsigned SPITUREN:1;
+        unsigned :3;
+        unsigned FRMERREN:1;
+        unsigned :3;
+    } bits;
+} SPI1IMSKL_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned PRSSEL:1;
+        unsigned :14;
+        unsigned DMAEN:1;
+    } bits;
+} DMACON_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned CHEN:1;
+        unsigned SIZE:1;
+        unsigned TRMODE:2;
+        unsigned DAMODE:2;
+        unsigned SAMODE:2;
+        unsigned CHREQ:1;
+        unsigned RELOAD:1;
+        unsigned NULLW:1;
+        unsigned :5;
+    } bits;
+} DMACH0_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned HALFEN:1;
+        unsigned :2;
+        unsigned OVRUNIF:1;
+        unsigned HALFIF:1;
+        unsigned DONEIF:1;
+        unsigned LOWIF:1;
+        unsigned HIGHIF:1;
+        unsigned CHSEL:7;
+        unsigned DBUFWF:1;
+    } bits;
+} DMAINT0_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned :3;
+        unsigned T1IF:1;
+        unsigned DMA0IF:1;
+        unsigned :11;
+    } bits;
+} IFS0_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned :3;
+        unsigned T1IE:1;
+        unsigned DMA0IE:1;
+        unsigned :11;
+    } bits;
+} IEC0_t;
+
+typedef union
+{
+    uint16_t w;
+    struct
+    {
+        unsigned :5;
+        unsigned IPL:3;
+        unsigned :8;
+    } bits;
+} SR_t;
+
+extern volatile SPI1CON1L_t SPI1CON1L_sfr;
+#define SPI1CON1L (SPI1CON1L_sfr.w)
+#define SPI1CON1Lbits (SPI1CON1L_sfr.bits)
+extern volatile SPI1CON1H_t SPI1CON1H_sfr;
+#define SPI1CON1H (SPI1CON1H_sfr.w)
+#define SPI1CON1Hbits (SPI1CON1H_sfr.bits)
+extern volatile SPI1IMSKL_t SPI1IMSKL_sfr;
+#define SPI1IMSKL (SPI1IMSKL_sfr.w)
+#define SPI1IMSKLbits (SPI1IMSKL_sfr.bits)
+extern volatile DMACON_t DMACON_sfr;
+#define DMACON (DMACON_sfr.w)
+#define DMACONbits (DMACON_sfr.bits)
+extern volatile DMACH0_t DMACH0_sfr;
+#define DMACH0 (DMACH0_sfr.w)
+#define DMACH0bits (DMACH0_sfr.bits)
+extern volatile DMAINT0_t DMAINT0_sfr;
+#define DMAINT0 (DMAINT0_sfr.w)
+#define DMAINT0bits (DMAINT0_sfr.bits)
+extern volatile IFS0_t IFS0_sfr;
+#define IFS0 (IFS0_sfr.w)
+#define IFS0bits (IFS0_sfr.bits)
+extern volatile IEC0_t IEC0_sfr;
+#define IEC0 (IEC0_sfr.w)
+#define IEC0bits (IEC0_sfr.bits)
+extern volatile SR_t SR_sfr;
+#define SR (SR_sfr.w)
+#define SRbits (SR_sfr.bits)
+
+extern volatile sfr_t LATA_sfr;
+#define LATA (LATA_sfr.w)
+#define LATAbits (LATA_sfr.bits)
+extern volatile sfr_t LATB_sfr;
+#define LATB (LATB_sfr.w)
+#define LATBbits (LATB_sfr.bits)
+extern volatile sfr_t LATC_sfr;
+#define LATC (LATC_sfr.w)
+#define LATCbits (LATC_sfr.bits)
+extern volatile sfr_t TRISA_sfr;
+#define TRISA (TRISA_sfr.w)
+#define TRISAbits (TRISA_sfr.bits)
+extern volatile sfr_t TRISB_sfr;
+#define TRISB (TRISB_sfr.w)
+#define TRISBbits (TRISB_sfr.bits)
+extern volatile sfr_t TRISC_sfr;
+#define TRISC (TRISC_sfr.w)
+#define TRISCbits (TRISC_sfr.bits)
+extern volatile sfr_t PORTA_sfr;
+#define PORTA (PORTA_sfr.w)
+#define PORTAbits (PORTA_sfr.bits)
+extern volatile sfr_t PORTB_sfr;
+#define PORTB (PORTB_sfr.w)
+#define PORTBbits (PORTB_sfr.bits)
+extern volatile sfr_t PORTC_sfr;
+#define PORTC (PORTC_sfr.w)
+#define PORTCbits (PORTC_sfr.bits)
+extern volatile sfr_t ANSA_sfr;
+#define ANSA (ANSA_sfr.w)
+#define ANSAbits (ANSA_sfr.bits)
+extern volatile sfr_t ANSB_sfr;
+#define ANSB (ANSB_sfr.w)
+#define ANSBbits (ANSB_sfr.bits)
+extern volatile sfr_t ANSC_sfr;
+#define ANSC (ANSC_sfr.w)
+#define ANSCbits (ANSC_sfr.bits)
+extern volatile sfr_t IOCPDA_sfr;
+#define IOCPDA (IOCPDA_sfr.w)
+#define IOCPDAbits (IOCPDA_sfr.bits)
+extern volatile sfr_t IOCPDB_sfr;
+#define IOCPDB (IOCPDB_sfr.w)
+#define IOCPDBbits (IOCPDB_sfr.bits)
+extern volatile sfr_t IOCPDC_sfr;
+#define IOCPDC (IOCPDC_sfr.w)
+#define IOCPDCbits (IOCPDC_sfr.bits)
+extern volatile sfr_t IOCPUA_sfr;
+#define IOCPUA (IOCPUA_sfr.w)
+#define IOCPUAbits (IOCPUA_sfr.bits)
+extern volatile sfr_t IOCPUB_sfr;
+#define IOCPUB (IOCPUB_sfr.w)
+#define IOCPUBbits (IOCPUB_sfr.bits)
+extern volatile sfr_t IOCPUC_sfr;
+#define IOCPUC (IOCPUC_sfr.w)
+#define IOCPUCbits (IOCPUC_sfr.bits)
+extern volatile sfr_t ODCA_sfr;
+#define ODCA (ODCA_sfr.w)
+#define ODCAbits (ODCA_sfr.bits)
+extern volatile sfr_t ODCB_sfr;
+#define ODCB (ODCB_sfr.w)
+#define ODCBbits (ODCB_sfr.bits)
+extern volatile sfr_t ODCC_sfr;
+#define ODCC (ODCC_sfr.w)
+#define ODCCbits (ODCC_sfr.bits)
+extern volatile sfr_t SPI1CON2L_sfr;
+#define SPI1CON2L (SPI1CON2L_sfr.w)
+#define SPI1CON2Lbits (SPI1CON2L_sfr.bits)
+extern volatile sfr_t SPI1STATH_sfr;
+#define SPI1STATH (SPI1STATH_sfr.w)
+#define SPI1STATHbits (SPI1STATH_sfr.bits)
+extern volatile sfr_t SPI1BUFH_sfr;
+#define SPI1BUFH (SPI1BUFH_sfr.w)
+#define SPI1BUFHbits (SPI1BUFH_sfr.bits)
+extern volatile sfr_t SPI1BRGL_sfr;
+#define SPI1BRGL (SPI1BRGL_sfr.w)
+#define SPI1BRGLbits (SPI1BRGL_sfr.bits)
+extern volatile sfr_t SPI1IMSKH_sfr;
+#define SPI1IMSKH (SPI1IMSKH_sfr.w)
+#define SPI1IMSKHbits (SPI1IMSKH_sfr.bits)
+extern volatile sfr_t I2C1CONL_sfr;
+#define I2C1CONL (I2C1CONL_sfr.w)
+#define I2C1CONLbits (I2C1CONL_sfr.bits)
+extern volatile sfr_t I2C1CONH_sfr;
+#define I2C1CONH (I2C1CONH_sfr.w)
+#define I2C1CONHbits (I2C1CONH_sfr.bits)
+extern volatile sfr_t I2C1STAT_sfr;
+#define I2C1STAT (I2C1STAT_sfr.w)
+#define I2C1STATbits (I2C1STAT_sfr.bits)
+extern volatile sfr_t I2C1BRG_sfr;
+#define I2C1BRG (I2C1BRG_sfr.w)
+#define I2C1BRGbits (I2C1BRG_sfr.bits)
+extern volatile sfr_t I2C1TRN_sfr;
+#define I2C1TRN (I2C1TRN_sfr.w)
+#define I2C1TRNbits (I2C1TRN_sfr.bits)
+extern volatile sfr_t I2C1RCV_sfr;
+#define I2C1RCV (I2C1RCV_sfr.w)
+#define I2C1RCVbits (I2C1RCV_sfr.bits)
+extern volatile sfr_t T1CON_sfr;
+#define T1CON (T1CON_sfr.w)
+#define T1CONbits (T1CON_sfr.bits)
+extern volatile sfr_t TMR1_sfr;
+#define TMR1 (TMR1_sfr.w)
+#define TMR1bits (TMR1_sfr.bits)
+extern volatile sfr_t PR1_sfr;
+#define PR1 (PR1_sfr.w)
+#define PR1bits (PR1_sfr.bits)
+extern volatile sfr_t IFS1_sfr;
+#define IFS1 (IFS1_sfr.w)
+#define IFS1bits (IFS1_sfr.bits)
+extern volatile sfr_t IFS2_sfr;
+#define IFS2 (IFS2_sfr.w)
+#define IFS2bits (IFS2_sfr.bits)
+extern volatile sfr_t IFS3_sfr;
+#define IFS3 (IFS3_sfr.w)
+#define IFS3bits (IFS3_sfr.bits)
+extern volatile sfr_t IFS4_sfr;
+#define IFS4 (IFS4_sfr.w)
+#define IFS4bits (IFS4_sfr.bits)
+extern volatile sfr_t IEC1_sfr;
+#define IEC1 (IEC1_sfr.w)
+#define IEC1bits (IEC1_sfr.bits)
+extern volatile sfr_t IEC2_sfr;
+#define IEC2 (IEC2_sfr.w)
+#define IEC2bits (IEC2_sfr.bits)
+extern volatile sfr_t IEC3_sfr;
+#define IEC3 (IEC3_sfr.w)
+#define IEC3bits (IEC3_sfr.bits)
+extern volatile sfr_t IEC4_sfr;
+#define IEC4 (IEC4_sfr.w)
+#define IEC4bits (IEC4_sfr.bits)
+extern volatile sfr_t IPC0_sfr;
+#define IPC0 (IPC0_sfr.w)
+#define IPC0bits (IPC0_sfr.bits)
+extern volatile sfr_t IPC1_sfr;
+#define IPC1 (IPC1_sfr.w)
+#define IPC1bits (IPC1_sfr.bits)
+extern volatile sfr_t IPC2_sfr;
+#define IPC2 (IPC2_sfr.w)
+#define IPC2bits (IPC2_sfr.bits)
+extern volatile sfr_t IPC3_sfr;
+#define IPC3 (IPC3_sfr.w)
+#define IPC3bits (IPC3_sfr.bits)
+extern volatile sfr_t IPC4_sfr;
+#define IPC4 (IPC4_sfr.w)
+#define IPC4bits (IPC4_sfr.bits)
+extern volatile sfr_t AD1CON1_sfr;
+#define AD1CON1 (AD1CON1_sfr.w)
+#define AD1CON1bits (AD1CON1_sfr.bits)
+extern volatile sfr_t AD1CON2_sfr;
+#define AD1CON2 (AD1CON2_sfr.w)
+#define AD1CON2bits (AD1CON2_sfr.bits)
+extern volatile sfr_t AD1CON3_sfr;
+#define AD1CON3 (AD1CON3_sfr.w)
+#define AD1CON3bits (AD1CON3_sfr.bits)
+extern volatile sfr_t AD1CHS_sfr;
+#define AD1CHS (AD1CHS_sfr.w)
+#define AD1CHSbits (AD1CHS_sfr.bits)
+extern volatile sfr_t CLKDIV_sfr;
+#define CLKDIV (CLKDIV_sfr.w)
+#define CLKDIVbits (CLKDIV_sfr.bits)
+extern volatile sfr_t OSCTUN_sfr;
+#define OSCTUN (OSCTUN_sfr.w)
+#define OSCTUNbits (OSCTUN_sfr.bits)
+extern volatile sfr_t REFOCONL_sfr;
+#define REFOCONL (REFOCONL_sfr.w)
+#define REFOCONLbits (REFOCONL_sfr.bits)
+extern volatile sfr_t REFOCONH_sfr;
+#define REFOCONH (REFOCONH_sfr.w)
+#define REFOCONHbits (REFOCONH_sfr.bits)
+extern volatile sfr_t DCOTUN_sfr;
+#define DCOTUN (DCOTUN_sfr.w)
+#define DCOTUNbits (DCOTUN_sfr.bits)
+extern volatile sfr_t DCOCON_sfr;
+#define DCOCON (DCOCON_sfr.w)
+#define DCOCONbits (DCOCON_sfr.bits)
+extern volatile sfr_t OSCDIV_sfr;
+#define OSCDIV (OSCDIV_sfr.w)
+#define OSCDIVbits (OSCDIV_sfr.bits)
+extern volatile sfr_t OSCFDIV_sfr;
+#define OSCFDIV (OSCFDIV_sfr.w)
+#define OSCFDIVbits (OSCFDIV_sfr.bits)
+extern volatile sfr_t OSCCON_sfr;
+#define OSCCON (OSCCON_sfr.w)
+#define OSCCONbits (OSCCON_sfr.bits)
+extern volatile sfr_t PMD1_sfr;
+#define PMD1 (PMD1_sfr.w)
+#define PMD1bits (PMD1_sfr.bits)
+extern volatile sfr_t PMD2_sfr;
+#define PMD2 (PMD2_sfr.w)
+#define PMD2bits (PMD2_sfr.bits)
+extern volatile sfr_t PMD3_sfr;
+#define PMD3 (PMD3_sfr.w)
+#define PMD3bits (PMD3_sfr.bits)
+extern volatile sfr_t PMD4_sfr;
+#define PMD4 (PMD4_sfr.w)
+#define PMD4bits (PMD4_sfr.bits)
+extern volatile sfr_t PMD5_sfr;
+#define PMD5 (PMD5_sfr.w)
+#define PMD5bits (PMD5_sfr.bits)
+extern volatile sfr_t PMD6_sfr;
+#define PMD6 (PMD6_sfr.w)
+#define PMD6bits (PMD6_sfr.bits)
+extern volatile sfr_t PMD7_sfr;
+#define PMD7 (PMD7_sfr.w)
+#define PMD7bits (PMD7_sfr.bits)
+extern volatile sfr_t PMD8_sfr;
+#define PMD8 (PMD8_sfr.w)
+#define PMD8bits (PMD8_sfr.bits)
+extern volatile sfr_t RPOR7_sfr;
+#define RPOR7 (RPOR7_sfr.w)
+#define RPOR7bits (RPOR7_sfr.bits)
+extern volatile sfr_t RPINR20_sfr;
+#define RPINR20 (RPINR20_sfr.w)
+#define RPINR20bits (RPINR20_sfr.bits)
+extern volatile sfr_t INTCON1_sfr;
+#define INTCON1 (INTCON1_sfr.w)
+#define INTCON1bits (INTCON1_sfr.bits)
+extern volatile sfr_t INTCON2_sfr;
+#define INTCON2 (INTCON2_sfr.w)
+#define INTCON2bits (INTCON2_sfr.bits)
+extern volatile sfr_t INTCON4_sfr;
+#define INTCON4 (INTCON4_sfr.w)
+#define INTCON4bits (INTCON4_sfr.bits)
+extern volatile sfr_t SPLIM_sfr;
+#define SPLIM (SPLIM_sfr.w)
+#define SPLIMbits (SPLIM_sfr.bits)
+extern volatile sfr_t DMABUF_sfr;
+#define DMABUF (DMABUF_sfr.w)
+#define DMABUFbits (DMABUF_sfr.bits)
+extern volatile sfr_t DMAL_sfr;
+#define DMAL (DMAL_sfr.w)
+#define DMALbits (DMAL_sfr.bits)
+extern volatile sfr_t DMAH_sfr;
+#define DMAH (DMAH_sfr.w)
+#define DMAHbits (DMAH_sfr.bits)
+extern volatile sfr_t DMACNT0_sfr;
+#define DMACNT0 (DMACNT0_sfr.w)
+#define DMACNT0bits (DMACNT0_sfr.bits)
+
+/* DMA address registers are pointer wide here, so the model can follow
+ * what the driver loads into them. */
+extern volatile uintptr_t DMASRC0_sfr;
+extern volatile uintptr_t DMADST0_sfr;
+#define DMASRC0 DMASRC0_sfr
+#define DMADST0 DMADST0_sfr
+
+/* SPI1BUFL reads give 0x10000 | data, so the model can tell a write of
+ * any 16-bit word from a read left standing. */
+volatile uint32_t *sfr_spi1Buffer(void);
+volatile SPI1STATL_t *sfr_spi1Status(void);
+#define SPI1BUFL (*sfr_spi1Buffer())
+#define SPI1STATL (sfr_spi1Status()->w)
+#define SPI1STATLbits (sfr_spi1Status()->bits)
+
+#define __builtin_write_OSCCONL(x) (OSCCON = (x))
+#define __builtin_write_OSCCONH(x) (OSCCON = (x))
+/* XC16 attributes gcc would reject or misread on the host. */
+#define __interrupt__ __used__
+#define interrupt used
+#define auto_psv unused
+#define no_auto_psv unused
+
+/* Busy-wait loops spin on Nop(), so the model runs while they wait. */
+void sfr_run(uint32_t cycles);
+#define Nop() sfr_run(1)
+#define Sleep() ((void)0)
+#define Idle() ((void)0)
+#define ClrWdt() ((void)0)
+
+#endif /* XC_H */
@@ -0,0 +1,171 @@
+/*
+ * File:   panel_model.c
+ *
+ * SSD1351 command decoding on top of the SPI1 model's shift hook. A word
+ * in MODE16 is two bytes, high byte first, exactly as the panel sees it.
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include <xc.h>
+#include "sfr_model.h"
+#include "panel_model.h"
+
+#define CMD_SET_COLUMN 0x15
+#define CMD_SET_ROW 0x75
+#define CMD_WRITE_RAM 0x5C
+#define CMD_READ_RAM 0x5D
+#define CMD_NONE 0x00
+#define RAM_DIM 128
+
+panel_stats_t panelStats;
+uint16_t panelImage[PANEL_DIM][PANEL_DIM];
+uint8_t panelWrites[PANEL_DIM][PANEL_DIM];
+
+static uint8_t command = CMD_NONE;
+static uint8_t parameters;      /* parameter bytes taken since the command */
+static uint8_t columnStart, columnEnd, rowStart, rowEnd;
+static uint8_t column, row;
+static uint8_t pixelHigh;
+static bool highPending;
+
+static void writePixel(uint16_t color)
+{
+    uint8_t x = column - PANEL_COLUMN_OFFSET;
+
+    panelStats.pixels++;
+    if(column < PANEL_COLUMN_OFFSET || x >= PANEL_DIM || row >= PANEL_DIM)
+    {
+        panelStats.outside++;
+    }
+    else
+    {
+        panelImage[row][x] = color;
+        if(panelWrites[row][x] < 0xFF)
+        {
+            panelWrites[row][x]++;
+        }
+    }
+    if(column == columnEnd)
+    {
+        column = columnStart;
+        row = row == rowEnd ? rowStart : row + 1;
+    }
+    else
+    {
+        column = (column + 1) & (RAM_DIM - 1);
+    }
+}
+
+static void takeData(uint8_t value)
+{
+    panelStats.dataBytes++;
+    switch(command)
+    {
+        case CMD_SET_COLUMN:
+        case CMD_SET_ROW:
+            if(parameters == 0)
+            {
+                *(command == CMD_SET_COLUMN ? &columnStart : &rowStart) = value & (RAM_DIM - 1);
+            }
+            else if(parameters == 1)
+            {
+                if(command == CMD_SET_COLUMN)
+                {
+                    columnEnd = value & (RAM_DIM - 1);
+                    column = columnStart;
+                }
+                else
+                {
+                    rowEnd = value & (RAM_DIM - 1);
+                    row = rowStart;
+                }
+            }
+            break;
+        case CMD_WRITE_RAM:
+            if(!highPending)
+            {
+                pixelHigh = value;
+                highPending = true;
+            }
+            else
+            {
+                highPending = false;
+                writePixel(((uint16_t)pixelHigh << 8) | value);
+            }
+            break;
+        case CMD_READ_RAM:
+            break;
+        case CMD_NONE:
+            panelStats.strayData++;
+            break;
+        default:
+            break;
+    }
+    if(parameters < 0xFF)
+    {
+        parameters++;
+    }
+}
+
+static void takeByte(uint8_t value)
+{
+    if(LATCbits.LATC9)
+    {
+        panelStats.deselected++;
+        return;
+    }
+    if(!LATCbits.LATC3)
+    {
+        panelStats.commands++;
+        command = value;
+        parameters = 0;
+        highPending = false;
+        return;
+    }
+    takeData(value);
+}
+
+static void shifted(uint16_t value, uint8_t bits)
+{
+    if(bits == 16)
+    {
+        takeByte(value >> 8);
+    }
+    takeByte(value & 0xFF);
+}
+
+void panel_reset(uint16_t color)
+{
+    uint8_t x, y;
+
+    for(y = 0; y < PANEL_DIM; y++)
+    {
+        for(x = 0; x < PANEL_DIM; x++)
+        {
+            panelImage[y][x] = color;
+        }
+    }
+    command = CMD_NONE;
+    parameters = 0;
+    highPending = false;
+    columnStart = 0;
+    columnEnd = RAM_DIM - 1;
+    rowStart = 0;
+    rowEnd = RAM_DIM - 1;
+    column = 0;
+    row = 0;
+    panel_clearCounts();
+    sfr_setShiftHook(shifted);
+}
+
+void panel_clearCounts(void)
+{
+    memset(&panelStats, 0, sizeof panelStats);
+    memset(panelWrites, 0, sizeof panelWrites);
+}
+
+uint32_t panel_bytes(void)
+{
+    return panelStats.commands + panelStats.dataBytes;
+}
@@ -0,0 +1,44 @@
+/*
+ * File:   panel_model.h
+ *
+ * Host model of the SSD1351 as the OLED C click wires it: D/C on LATC3 and
+ * nCS on LATC9, sampled as each byte or word finishes shifting out of SPI1.
+ * It keeps the column/row window and the RAM write pointer and decodes
+ * pixel writes into a 96x96 RGB565 image, counting the writes per pixel.
+ * Only the window, write RAM and read RAM commands are decoded; the
+ * parameters of any other command are skipped.
+ */
+
+#ifndef PANEL_MODEL_H
+#define PANEL_MODEL_H
+
+#include <stdint.h>
+
+#define PANEL_DIM 96
+#define PANEL_COLUMN_OFFSET 16 /* panel column 0 is SSD1351 column 16 */
+
+typedef struct
+{
+    uint32_t commands;       /* command bytes (D/C low) */
+    uint32_t dataBytes;      /* parameter and pixel bytes (D/C high) */
+    uint32_t pixels;         /* pixels written to RAM */
+    uint32_t outside;        /* pixels written off the visible 96x96 */
+    uint32_t deselected;     /* bytes shifted out with nCS high */
+    uint32_t strayData;      /* data bytes with no command to take them */
+} panel_stats_t;
+
+extern panel_stats_t panelStats;
+extern uint16_t panelImage[PANEL_DIM][PANEL_DIM];
+extern uint8_t panelWrites[PANEL_DIM][PANEL_DIM];
+
+/* Fills the image with color, clears counts and statistics and attaches
+ * the model to the SPI1 model. The window is the SSD1351 reset default. */
+void panel_reset(uint16_t color);
+
+/* Clears the write counts and statistics, keeping the image. */
+void panel_clearCounts(void);
+
+/* Bytes on the bus since the last reset or clear, commands included */
+uint32_t panel_bytes(void);
+
+#endif /* PANEL_MODEL_H */
@@ -0,0 +1,51 @@
+#!/bin/sh
+#
+# Builds and runs the host tests with gcc against the register stand-ins in
+# include/ and the SPI1/DMA0 model. Each t_*.c names the project sources it
+# links on a "host-sources:" line; sample_images.c there is generated from
+# tools/samples. Usage: test/host/run.sh [t_name.c ...]
+#
+HOST=$(cd "$(dirname "$0")" && pwd)
+REPO=$(cd "$HOST/../.." && pwd)
+OUT=${HOST_BUILD:-${TMPDIR:-/tmp}/host-tests}
+CC=${CC:-gcc}
+
+# Drivers include "../system/...", which a case-sensitive host resolves
+# through this link from $OUT/include/..
+mkdir -p "$OUT/include" || exit 1
+ln -sfn "$REPO/System" "$OUT/system"
+
+S="$REPO/tools/samples"
+python3 "$REPO/tools/mkimage.py" --raw "$OUT/sample_images" logo="$S/logo.ppm" face="$S/face.png" \
+    vgrad="$S/vgrad.png" xygrad="$S/xygrad.png" noise="$S/noise.png" 2>/dev/null || exit 1
+
+cd "$HOST" || exit 1
+[ $# -eq 0 ] && set -- t_*.c
+failed=0
+for test in "$@"; do
+    name=${test%.c}
+    sources=$(sed -n 's|.*host-sources:||p' "$test")
+    srcs=""
+    for s in $sources; do
+        if [ -f "$REPO/$s" ]; then
+            srcs="$srcs $REPO/$s"
+        else
+            srcs="$srcs $OUT/$s"
+        fi
+    done
+    if ! $CC -std=gnu99 -g -O0 -Wall -Wno-unknown-pragmas -Wno-attributes \
+            -DFCY=4000000UL -I"$HOST/include" -I"$OUT/include" -I"$HOST" -I"$REPO" \
+            -I"$REPO/oledDriver" -I"$OUT" \
+            -o "$OUT/$name" "$test" sfr.c sfr_model.c $srcs -lm; then
+        echo "$name: BUILD FAILED"
+        failed=1
+        continue
+    fi
+    if "$OUT/$name"; then
+        echo "$name: ok"
+    else
+        echo "$name: FAILED"
+        failed=1
+    fi
+done
+exit $failed
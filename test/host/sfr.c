@@ -0,0 +1,98 @@
+/*
+ * File:   sfr.c
+ *
+ * Storage for the plain register stand-ins declared in include/xc.h.
+ */
+
+#include <xc.h>
+
+volatile SPI1CON1L_t SPI1CON1L_sfr;
+volatile SPI1CON1H_t SPI1CON1H_sfr;
+volatile SPI1IMSKL_t SPI1IMSKL_sfr;
+volatile DMACON_t DMACON_sfr;
+volatile DMACH0_t DMACH0_sfr;
+volatile DMAINT0_t DMAINT0_sfr;
+volatile IFS0_t IFS0_sfr;
+volatile IEC0_t IEC0_sfr;
+volatile SR_t SR_sfr;
+volatile sfr_t LATA_sfr;
+volatile sfr_t LATB_sfr;
+volatile sfr_t LATC_sfr;
+volatile sfr_t TRISA_sfr;
+volatile sfr_t TRISB_sfr;
+volatile sfr_t TRISC_sfr;
+volatile sfr_t PORTA_sfr;
+volatile sfr_t PORTB_sfr;
+volatile sfr_t PORTC_sfr;
+volatile sfr_t ANSA_sfr;
+volatile sfr_t ANSB_sfr;
+volatile sfr_t ANSC_sfr;
+volatile sfr_t IOCPDA_sfr;
+volatile sfr_t IOCPDB_sfr;
+volatile sfr_t IOCPDC_sfr;
+volatile sfr_t IOCPUA_sfr;
+volatile sfr_t IOCPUB_sfr;
+volatile sfr_t IOCPUC_sfr;
+volatile sfr_t ODCA_sfr;
+volatile sfr_t ODCB_sfr;
+volatile sfr_t ODCC_sfr;
+volatile sfr_t SPI1CON2L_sfr;
+volatile sfr_t SPI1STATH_sfr;
+volatile sfr_t SPI1BUFH_sfr;
+volatile sfr_t SPI1BRGL_sfr;
+volatile sfr_t SPI1IMSKH_sfr;
+volatile sfr_t I2C1CONL_sfr;
+volatile sfr_t I2C1CONH_sfr;
+volatile sfr_t I2C1STAT_sfr;
+volatile sfr_t I2C1BRG_sfr;
+volatile sfr_t I2C1TRN_sfr;
+volatile sfr_t I2C1RCV_sfr;
+volatile sfr_t T1CON_sfr;
+volatile sfr_t TMR1_sfr;
+volatile sfr_t PR1_sfr;
+volatile sfr_t IFS1_sfr;
+volatile sfr_t IFS2_sfr;
+volatile sfr_t IFS3_sfr;
+volatile sfr_t IFS4_sfr;
+volatile sfr_t IEC1_sfr;
+volatile sfr_t IEC2_sfr;
+volatile sfr_t IEC3_sfr;
+volatile sfr_t IEC4_sfr;
+volatile sfr_t IPC0_sfr;
+volatile sfr_t IPC1_sfr;
+volatile sfr_t IPC2_sfr;
+volatile sfr_t IPC3_sfr;
+volatile sfr_t IPC4_sfr;
+volatile sfr_t AD1CON1_sfr;
+volatile sfr_t AD1CON2_sfr;
+volatile sfr_t AD1CON3_sfr;
+volatile sfr_t AD1CHS_sfr;
+volatile sfr_t CLKDIV_sfr;
+volatile sfr_t OSCTUN_sfr;
+volatile sfr_t REFOCONL_sfr;
+volatile sfr_t REFOCONH_sfr;
+volatile sfr_t DCOTUN_sfr;
+volatile sfr_t DCOCON_sfr;
+volatile sfr_t OSCDIV_sfr;
+volatile sfr_t OSCFDIV_sfr;
+volatile sfr_t OSCCON_sfr;
+volatile sfr_t PMD1_sfr;
+volatile sfr_t PMD2_sfr;
+volatile sfr_t PMD3_sfr;
+volatile sfr_t PMD4_sfr;
+volatile sfr_t PMD5_sfr;
+volatile sfr_t PMD6_sfr;
+volatile sfr_t PMD7_sfr;
+volatile sfr_t PMD8_sfr;
+volatile sfr_t RPOR7_sfr;
+volatile sfr_t RPINR20_sfr;
+volatile sfr_t INTCON1_sfr;
+volatile sfr_t INTCON2_sfr;
+volatile sfr_t INTCON4_sfr;
+volatile sfr_t SPLIM_sfr;
+volatile sfr_t DMABUF_sfr;
+volatile sfr_t DMAL_sfr;
+volatile sfr_t DMAH_sfr;
+volatile sfr_t DMACNT0_sfr;
+volatile uintptr_t DMASRC0_sfr;
+volatile uintptr_t DMADST0_sfr;
@@ -0,0 +1,341 @@
+/*
+ * File:   sfr_model.c
+ *
+ * SPI1 and DMA0 behind the SPI1BUFL/SPI1STATL stand-ins. The model steps
+ * one Tcy at a time:
+ *  - the shift register takes the next FIFO entry as soon as it is free and
+ *    clocks it out in 8 or 16 bit times of 2 * (SPI1BRGL + 1) Tcy;
+ *  - a TX FIFO that drains to empty raises the SPI1 transmit event when
+ *    SPI1IMSKL.SPITBEN is set, which is DMA trigger 0x0B;
+ *  - DMA0 moves one word per Tcy, one per trigger in one-shot mode or the
+ *    whole block at once in continuous mode, and raises DONEIF/DMA0IF when
+ *    DMACNT0 reaches zero;
+ *  - _DMA0Interrupt() is called when DMA0IF is enabled above SR.IPL.
+ *
+ * A CPU write to SPI1BUFL is only seen at the next register access or
+ * sfr_run(), since the stand-in is plain memory behind an accessor.
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include <xc.h>
+#include "sfr_model.h"
+
+#define SPI1_TX_TRIGGER 0x0B
+#define FIFO_MAX 16
+/* Marks an SPI1BUFL read: stored reads carry this bit, CPU writes cannot */
+#define BUFFER_READ 0x10000UL
+
+extern void _DMA0Interrupt(void) __attribute__((weak));
+
+sfr_model_stats_t sfrStats;
+
+static volatile uint32_t spi1Buffer;
+static volatile SPI1STATL_t spi1Status;
+
+static uint16_t txFifo[FIFO_MAX];
+static uint8_t txCount;
+static uint16_t rxFifo[FIFO_MAX];
+static uint8_t rxCount;
+static bool rxPresented;
+static bool receiveOverrun;
+
+static bool shifting;
+static uint16_t shiftLeft;
+static uint16_t shiftValue;
+static uint8_t shiftBits;
+static uint16_t *capture;
+static uint32_t captureSize;
+static void (*shiftHook)(uint16_t value, uint8_t bits);
+
+static uint16_t dmaRequests; /* one-shot triggers not yet served */
+static bool dmaBlock;        /* continuous mode block in progress */
+static bool inInterrupt;
+
+static uint8_t fifoDepth(void)
+{
+    if(!SPI1CON1Lbits.ENHBUF)
+    {
+        return 1;
+    }
+    return SPI1CON1Lbits.MODE16 ? 8 : 16;
+}
+
+static uint16_t unitMask(void)
+{
+    return SPI1CON1Lbits.MODE16 ? 0xFFFF : 0x00FF;
+}
+
+static void transmitEvent(void)
+{
+    if(!SPI1IMSKLbits.SPITBEN || DMAINT0bits.CHSEL != SPI1_TX_TRIGGER || !DMACH0bits.CHEN)
+    {
+        return;
+    }
+    sfrStats.dmaTriggers++;
+    if(DMACH0bits.TRMODE & 2)
+    {
+        dmaBlock = true;
+    }
+    else
+    {
+        dmaRequests++;
+    }
+}
+
+static void txPush(uint16_t value)
+{
+    if(!SPI1CON1Lbits.SPIEN)
+    {
+        return;
+    }
+    if(txCount == fifoDepth())
+    {
+        sfrStats.txLost++;
+        return;
+    }
+    txFifo[txCount++] = value & unitMask();
+    sfrStats.txWrites++;
+    if(txCount > sfrStats.txPeak)
+    {
+        sfrStats.txPeak = txCount;
+    }
+}
+
+static void stepShifter(void)
+{
+    if(shifting && --shiftLeft == 0)
+    {
+        shifting = false;
+        if(capture != NULL && sfrStats.shifted < captureSize)
+        {
+            capture[sfrStats.shifted] = shiftValue;
+        }
+        sfrStats.shifted++;
+        if(shiftHook != NULL)
+        {
+            shiftHook(shiftValue, shiftBits);
+        }
+        if(rxCount < fifoDepth())
+        {
+            rxFifo[rxCount++] = 0;
+        }
+        else if(!SPI1CON1Hbits.IGNROV)
+        {
+            receiveOverrun = true;
+            sfrStats.rxOverruns++;
+        }
+    }
+    if(!shifting && txCount != 0)
+    {
+        shiftValue = txFifo[0];
+        memmove(txFifo, txFifo + 1, --txCount * sizeof txFifo[0]);
+        shifting = true;
+        shiftBits = SPI1CON1Lbits.MODE16 ? 16 : 8;
+        shiftLeft = shiftBits * 2 * (SPI1BRGL + 1);
+        if(txCount == 0)
+        {
+            transmitEvent();
+        }
+    }
+}
+
+static void stepDma(void)
+{
+    if(!DMACONbits.DMAEN || !DMACH0bits.CHEN)
+    {
+        dmaRequests = 0;
+        dmaBlock = false;
+        return;
+    }
+    if(DMACH0bits.CHREQ)
+    {
+        DMACH0bits.CHREQ = 0;
+        if(DMACH0bits.TRMODE & 2)
+        {
+            dmaBlock = true;
+        }
+        else
+        {
+            dmaRequests++;
+        }
+    }
+    if(!dmaBlock && dmaRequests == 0)
+    {
+        return;
+    }
+    if(DMADST0 == (uintptr_t)&spi1Buffer)
+    {
+        txPush(*(const uint16_t *)DMASRC0);
+    }
+    else
+    {
+        sfrStats.dmaBadAddress++;
+    }
+    sfrStats.dmaTransfers++;
+    if(DMACH0bits.SAMODE == 1)
+    {
+        DMASRC0 += sizeof(uint16_t);
+    }
+    if(dmaRequests)
+    {
+        dmaRequests--;
+    }
+    if(--DMACNT0 == 0)
+    {
+        dmaBlock = false;
+        dmaRequests = 0;
+        DMACH0bits.CHEN = 0;
+        DMAINT0bits.DONEIF = 1;
+        IFS0bits.DMA0IF = 1;
+        sfrStats.dmaDone++;
+    }
+}
+
+/* Applies the CPU's last SPI1BUFL access: a write lands below BUFFER_READ */
+static void settle(void)
+{
+    if(spi1Buffer < BUFFER_READ)
+    {
+        txPush((uint16_t)spi1Buffer);
+    }
+    else if(rxPresented)
+    {
+        memmove(rxFifo, rxFifo + 1, --rxCount * sizeof rxFifo[0]);
+    }
+    rxPresented = false;
+    spi1Buffer = BUFFER_READ;
+    if(!spi1Status.bits.SPIROV)
+    {
+        receiveOverrun = false;
+    }
+}
+
+static void tick(void)
+{
+    sfrStats.cycles++;
+    if(!SPI1CON1Lbits.SPIEN)
+    {
+        txCount = 0;
+        rxCount = 0;
+        shifting = false;
+    }
+    stepShifter();
+    stepDma();
+    if(!inInterrupt && IFS0bits.DMA0IF && IEC0bits.DMA0IE && IPC1bits.DMA0IP > SRbits.IPL && _DMA0Interrupt)
+    {
+        inInterrupt = true;
+        sfrStats.dmaInterrupts++;
+        _DMA0Interrupt();
+        settle();
+        inInterrupt = false;
+    }
+}
+
+static void updateStatus(void)
+{
+    spi1Status.w = 0;
+    spi1Status.bits.SPIRBF = rxCount == fifoDepth();
+    spi1Status.bits.SPITBF = txCount == fifoDepth();
+    spi1Status.bits.SPITBE = txCount == 0;
+    spi1Status.bits.SPIRBE = rxCount == 0;
+    spi1Status.bits.SPIROV = receiveOverrun;
+    spi1Status.bits.SRMT = !shifting && txCount == 0;
+    spi1Status.bits.SPIBUSY = shifting;
+}
+
+static void access(void)
+{
+    uint8_t n;
+
+    settle();
+    for(n = 0; n < SFR_MODEL_ACCESS_TCY; n++)
+    {
+        tick();
+    }
+    updateStatus();
+}
+
+volatile uint32_t *sfr_spi1Buffer(void)
+{
+    access();
+    if(rxCount != 0)
+    {
+        spi1Buffer = BUFFER_READ | rxFifo[0];
+        rxPresented = true;
+    }
+    return &spi1Buffer;
+}
+
+volatile SPI1STATL_t *sfr_spi1Status(void)
+{
+    access();
+    return &spi1Status;
+}
+
+void sfr_reset(void)
+{
+    memset(&sfrStats, 0, sizeof sfrStats);
+    SPI1CON1L = 0;
+    SPI1CON1H = 0;
+    SPI1IMSKL = 0;
+    SPI1BRGL = 0;
+    DMACON = 0;
+    DMACH0 = 0;
+    DMAINT0 = 0;
+    DMASRC0 = 0;
+    DMADST0 = 0;
+    DMACNT0 = 0;
+    IFS0 = 0;
+    IEC0 = 0;
+    IPC1 = 0;
+    SR = 0;
+    spi1Buffer = BUFFER_READ;
+    txCount = 0;
+    rxCount = 0;
+    rxPresented = false;
+    receiveOverrun = false;
+    shifting = false;
+    dmaRequests = 0;
+    dmaBlock = false;
+    updateStatus();
+}
+
+void sfr_capture(uint16_t *buffer, uint32_t size)
+{
+    capture = buffer;
+    captureSize = size;
+}
+
+void sfr_setShiftHook(void (*hook)(uint16_t value, uint8_t bits))
+{
+    shiftHook = hook;
+}
+
+void sfr_run(uint32_t cycles)
+{
+    settle();
+    while(cycles--)
+    {
+        tick();
+    }
+    updateStatus();
+}
+
+bool sfr_runUntilIdle(uint32_t limit)
+{
+    settle();
+    while(limit--)
+    {
+        if(txCount == 0 && !shifting && !dmaBlock && dmaRequests == 0
+           && !(DMACH0bits.CHEN && DMACH0bits.CHREQ)
+           && !(IFS0bits.DMA0IF && IEC0bits.DMA0IE))
+        {
+            updateStatus();
+            return true;
+        }
+        tick();
+    }
+    updateStatus();
+    return false;
+}
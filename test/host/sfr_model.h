@@ -0,0 +1,57 @@
+/*
+ * File:   sfr_model.h
+ *
+ * Host model of SPI1 (enhanced buffer) and DMA channel 0, driven by the
+ * register stand-ins in include/xc.h. Time is counted in Tcy: each access
+ * to SPI1BUFL or SPI1STATL costs SFR_MODEL_ACCESS_TCY, and sfr_run() lets
+ * the bus and DMA run while the CPU does something else.
+ *
+ * Only register accesses are charged, so CPU-bound loops come out as lower
+ * bounds; anything limited by SCK is cycle exact.
+ */
+
+#ifndef SFR_MODEL_H
+#define SFR_MODEL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Tcy charged per polled SPI1 register access, loop overhead included */
+#define SFR_MODEL_ACCESS_TCY 4
+
+typedef struct
+{
+    uint32_t cycles;         /* Tcy since sfr_reset() */
+    uint32_t txWrites;       /* words or bytes accepted by the TX FIFO */
+    uint32_t txLost;         /* writes while the TX FIFO was full */
+    uint32_t shifted;        /* words or bytes clocked out */
+    uint32_t rxOverruns;     /* receptions lost to a full RX FIFO */
+    uint32_t dmaTriggers;    /* SPI1 transmit events seen by DMA0 */
+    uint32_t dmaTransfers;   /* words DMA0 moved */
+    uint32_t dmaDone;        /* completed blocks (DONEIF) */
+    uint32_t dmaInterrupts;  /* _DMA0Interrupt() calls */
+    uint32_t dmaBadAddress;  /* transfers with a destination other than SPI1BUFL */
+    uint8_t txPeak;          /* deepest TX FIFO level seen */
+} sfr_model_stats_t;
+
+extern sfr_model_stats_t sfrStats;
+
+/* Clears every modelled register, both FIFOs and the statistics. */
+void sfr_reset(void);
+
+/* Lets the model run for cycles Tcy without any CPU register access. */
+void sfr_run(uint32_t cycles);
+
+/* Records up to size shifted words or bytes into buffer; NULL stops. */
+void sfr_capture(uint16_t *buffer, uint32_t size);
+
+/* Calls hook with every word or byte as its last bit clocks out, while
+ * the pins the CPU drives still hold their value; NULL stops. Kept across
+ * sfr_reset(). */
+void sfr_setShiftHook(void (*hook)(uint16_t value, uint8_t bits));
+
+/* Runs until the TX FIFO and shifter are empty and DMA0 is idle, or until
+ * limit Tcy pass; true when it went idle. */
+bool sfr_runUntilIdle(uint32_t limit);
+
+#endif /* SFR_MODEL_H */
@@ -0,0 +1,108 @@
+/*
+ * Activity/inactivity gating against the ADXL345 model: at rest only
+ * INT_SOURCE is read, once a second; a walk raises activity, which starts
+ * the step pipeline at 25 Hz with none of the samples queued while idle;
+ * and once the walk stops, inactivity stops the pipeline again.
+ *
+ * host-sources: test/host/adxl345.c System/system.c System/clock.c System/delay.c
+ * host-sources: spiDriver/spi1_driver.c oledDriver/pin_manager.c oledDriver/oledC.c
+ * host-sources: oledDriver/oledC_shapes.c oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c
+ * host-sources: oledDriver/oledC_shadow.c oledDriver/oledC_scanline.c oledDriver/oledC_sprite.c
+ * host-sources: oledDriver/oledC_displayList.c
+ */
+
+#include <stdio.h>
+#include "adxl345.h"
+#include "check.h"
+
+#define main app_main
+#define printf(...) ((void)0)
+#include "main.c"
+#undef printf
+#undef main
+
+#define WALK_FROM_US 60000000UL
+#define WALK_TO_US 120000000UL
+
+static uint32_t noise = 1;
+
+/* About 8 mg of noise on a desk, with two steps a second from 60 s to 120 s */
+static adxl_sample_t deskWalkDesk(uint32_t us)
+{
+    adxl_sample_t s = { 10, -5, 256 };
+
+    noise = noise * 1103515245UL + 12345;
+    s.x += (noise >> 16) % 5 - 2;
+    s.z += (noise >> 20) % 5 - 2;
+    if(us >= WALK_FROM_US && us < WALK_TO_US && us % 500000 < 120000)
+    {
+        s.z += 150;
+    }
+    return s;
+}
+
+/* Runs serviceAccel() once a second, as the Timer1 tick asks for it */
+static void runSeconds(uint16_t seconds)
+{
+    while(seconds-- > 0)
+    {
+        adxl_run(1000000);
+        serviceAccel();
+    }
+}
+
+static void testGating(void)
+{
+    uint32_t transactions, overruns;
+    uint16_t steps;
+
+    adxl_reset();
+    adxl_setSource(deskWalkDesk);
+    initAccelerometer();
+    movementDetected = false;
+    accelEvents = 0;
+    stepCount = 0;
+
+    /* a minute on the desk: one INT_SOURCE read a second and no samples */
+    transactions = adxlStats.transactions;
+    runSeconds(59);
+    CHECK(!movementDetected);
+    CHECK(adxlStats.transactions - transactions == 59);
+    CHECK(adxlStats.dataReads == 0);
+    CHECK(adxl_fifoLevel() == FIFO_DEPTH);
+    CHECK(stepCount == 0);
+
+    /* the walk: activity, then 25 Hz and only samples taken at 25 Hz */
+    inactivityCounter = 200;
+    runSeconds(2);
+    CHECK(movementDetected);
+    CHECK(inactivityCounter == 0);
+    CHECK((adxl_peek(REG_BW_RATE) & 0x0F) == accelRates[ACCEL_RATE_25HZ].code);
+    overruns = adxlStats.overruns;
+    runSeconds(58);
+    CHECK(adxlStats.dataReads > 0);
+    CHECK(adxlStats.staleReads == 0);
+    CHECK(adxlStats.overruns == overruns);
+    /* 120 steps, less the one that raised activity and the FIFO's tail */
+    CHECK(stepCount >= 116 && stepCount <= 120);
+
+    /* back on the desk: inactivity after INACT_SECONDS, then no samples */
+    runSeconds(INACT_SECONDS + 2);
+    CHECK(!movementDetected);
+    CHECK((adxl_peek(REG_BW_RATE) & 0x0F) == accelRates[ACCEL_RATE_12HZ5].code);
+    steps = stepCount;
+    transactions = adxlStats.transactions;
+    runSeconds(60);
+    CHECK(!movementDetected);
+    CHECK(adxlStats.transactions - transactions == 60);
+    CHECK(stepCount == steps);
+    CHECK(adxlStats.staleReads == 0);
+    printf("desk/walk/desk: %u steps, %lu data reads, %lu stale\n", stepCount,
+           (unsigned long)adxlStats.dataReads, (unsigned long)adxlStats.staleReads);
+}
+
+int main(void)
+{
+    testGating();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,122 @@
+/*
+ * The pedometer's FIFO drain against the ADXL345 model: nothing is read
+ * below the watermark, a full FIFO gives up its oldest samples and the
+ * drain stops at its 32 entries, and one drain a second keeps up with a
+ * walk at 25 Hz. main.c is built in with its main() renamed and its
+ * printf() silenced.
+ *
+ * host-sources: test/host/adxl345.c System/system.c System/clock.c System/delay.c
+ * host-sources: spiDriver/spi1_driver.c oledDriver/pin_manager.c oledDriver/oledC.c
+ * host-sources: oledDriver/oledC_shapes.c oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c
+ * host-sources: oledDriver/oledC_shadow.c oledDriver/oledC_scanline.c oledDriver/oledC_sprite.c
+ * host-sources: oledDriver/oledC_displayList.c
+ */
+
+#include <stdio.h>
+#include "adxl345.h"
+#include "check.h"
+
+#define main app_main
+#define printf(...) ((void)0)
+#include "main.c"
+#undef printf
+#undef main
+
+/* Resting flat, then two steps a second: 120 ms of 0.6 g over gravity */
+static adxl_sample_t walk(uint32_t us)
+{
+    adxl_sample_t s = { 10, -5, 256 };
+
+    if(us % 500000 < 120000)
+    {
+        s.z += 150;
+    }
+    return s;
+}
+
+static void start(adxl_source_t source)
+{
+    adxl_reset();
+    adxl_setSource(source);
+    initAccelerometer();
+    stepCount = 0;
+    wasAboveThreshold = false;
+}
+
+static void testWatermark(void)
+{
+    uint32_t transactions;
+    uint8_t level;
+
+    start(walk);
+    CHECK(adxl_peek(REG_FIFO_CTL) == (FIFO_STREAM | accelRates[ACCEL_RATE_12HZ5].watermark));
+    adxl_run(500000);
+    level = adxl_fifoLevel();
+    CHECK(level > 0 && level < accelRates[ACCEL_RATE_12HZ5].watermark);
+    transactions = adxlStats.transactions;
+    detectStep();
+    /* below the watermark only FIFO_STATUS is read */
+    CHECK(adxlStats.transactions == transactions + 1);
+    CHECK(adxlStats.dataReads == 0);
+    CHECK(adxl_fifoLevel() == level);
+
+    adxl_run(400000);
+    level = adxl_fifoLevel();
+    CHECK(level >= accelRates[ACCEL_RATE_12HZ5].watermark);
+    CHECK(adxl_peek(REG_INT_SOURCE) & INT_WATERMARK);
+    transactions = adxlStats.transactions;
+    detectStep();
+    /* FIFO_STATUS, then one six-byte burst per entry */
+    CHECK(adxlStats.transactions == transactions + 1 + level);
+    CHECK(adxlStats.dataReads == level);
+    CHECK(adxl_fifoLevel() <= 1);
+    CHECK(!(adxl_peek(REG_INT_SOURCE) & INT_WATERMARK));
+    CHECK(adxlStats.staleReads == 0);
+}
+
+static void testOverflow(void)
+{
+    start(walk);
+    adxl_run(5000000);
+    CHECK(adxl_fifoLevel() == FIFO_DEPTH);
+    CHECK(adxlStats.overruns == adxlStats.samples - FIFO_DEPTH);
+    detectStep();
+    CHECK(adxlStats.dataReads == FIFO_DEPTH);
+    CHECK(adxl_fifoLevel() <= 1);
+    /* the newest 32 samples hold about five steps */
+    CHECK(stepCount >= 4 && stepCount <= 6);
+}
+
+static void testDrain(void)
+{
+    uint32_t transactions;
+    uint16_t second, walked;
+
+    start(walk);
+    CHECK(setAccelRate(ACCEL_RATE_25HZ, true));
+    transactions = adxlStats.transactions;
+    for(second = 0; second < 60; second++)
+    {
+        adxl_run(1000000);
+        detectStep();
+    }
+    CHECK(adxlStats.overruns == 0);
+    CHECK(adxlStats.staleReads == 0);
+    CHECK(adxl_fifoLevel() <= 1);
+    /* every step that has started so far, a step every 500 ms from 0 */
+    walked = adxl_now() / 500000 + 1;
+    CHECK(stepCount + 1 >= walked && stepCount <= walked);
+    /* 25 bursts and one FIFO_STATUS read a second */
+    CHECK(adxlStats.transactions - transactions <= 60 * 27);
+    printf("FIFO drain at 25 Hz: %u steps in 60 s, %lu transactions/s, %lu bytes/s\n",
+           stepCount, (unsigned long)(adxlStats.transactions - transactions) / 60,
+           (unsigned long)adxlStats.bytes / 60);
+}
+
+int main(void)
+{
+    testWatermark();
+    testOverflow();
+    testDrain();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,150 @@
+/*
+ * ADXL345 rate control against the model: setAccelRate() programs
+ * BW_RATE and the FIFO watermark or refuses, the sensor then samples at
+ * the rate getAccelLoad() reports, and the pedometer runs at 25 Hz while
+ * walking and drops back to 12.5 Hz at rest, with the bus load getAccelLoad()
+ * estimates for each.
+ *
+ * host-sources: test/host/adxl345.c System/system.c System/clock.c System/delay.c
+ * host-sources: spiDriver/spi1_driver.c oledDriver/pin_manager.c oledDriver/oledC.c
+ * host-sources: oledDriver/oledC_shapes.c oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c
+ * host-sources: oledDriver/oledC_shadow.c oledDriver/oledC_scanline.c oledDriver/oledC_sprite.c
+ * host-sources: oledDriver/oledC_displayList.c
+ */
+
+#include <stdio.h>
+#include "adxl345.h"
+#include "check.h"
+
+#define main app_main
+#define printf(...) ((void)0)
+#include "main.c"
+#undef printf
+#undef main
+
+#define WALK_US 30000000UL
+
+/* Two steps a second for the first 30 s, then flat on a desk */
+static adxl_sample_t walkThenRest(uint32_t us)
+{
+    adxl_sample_t s = { 10, -5, 256 };
+
+    if(us < WALK_US && us % 500000 < 120000)
+    {
+        s.z += 150;
+    }
+    return s;
+}
+
+static void start(void)
+{
+    adxl_reset();
+    adxl_setSource(walkThenRest);
+    initAccelerometer();
+    movementDetected = false;
+    accelEvents = 0;
+}
+
+static void testRates(void)
+{
+    ACCEL_LOAD_t load;
+    ACCEL_RATE_t rate;
+    uint8_t lowPower;
+    bool allowed;
+
+    start();
+    for(rate = 0; rate < ACCEL_RATE_COUNT; rate++)
+    {
+        for(lowPower = 0; lowPower < 2; lowPower++)
+        {
+            CHECK(setAccelRate(ACCEL_RATE_12HZ5, false));
+            allowed = !lowPower || accelRates[rate].lowPowerMicroamps != 0;
+            CHECK(setAccelRate(rate, lowPower) == allowed);
+            getAccelLoad(&load);
+            if(!allowed)
+            {
+                CHECK(adxl_peek(REG_BW_RATE) == accelRates[ACCEL_RATE_12HZ5].code);
+                CHECK(load.rate == ACCEL_RATE_12HZ5 && !load.lowPower);
+                continue;
+            }
+            CHECK(adxl_peek(REG_BW_RATE) == (accelRates[rate].code | (lowPower ? LOW_POWER : 0)));
+            CHECK(adxl_peek(REG_FIFO_CTL) == (FIFO_STREAM | accelRates[rate].watermark));
+            CHECK(load.rate == rate && load.lowPower == lowPower);
+            CHECK(load.centiHz == accelRates[rate].centiHz);
+            CHECK(load.bandwidthCentiHz == load.centiHz / 2);
+            CHECK(load.sensorMicroamps == (lowPower ? accelRates[rate].lowPowerMicroamps
+                                                    : accelRates[rate].normalMicroamps));
+        }
+    }
+    CHECK(!setAccelRate(ACCEL_RATE_COUNT, false));
+}
+
+static void testSampling(void)
+{
+    ACCEL_RATE_t rate;
+    uint32_t samples, expected;
+
+    for(rate = 0; rate < ACCEL_RATE_COUNT; rate++)
+    {
+        start();
+        CHECK(setAccelRate(rate, false));
+        samples = adxlStats.samples;
+        adxl_run(8000000);
+        expected = accelRates[rate].centiHz * 8UL / 100;
+        samples = adxlStats.samples - samples;
+        CHECK(samples + 1 >= expected && samples <= expected);
+    }
+}
+
+/* Runs serviceAccel() once a second and returns the bus bytes it took */
+static uint32_t runSeconds(uint16_t seconds)
+{
+    uint32_t bytes = adxlStats.bytes;
+
+    while(seconds-- > 0)
+    {
+        adxl_run(1000000);
+        serviceAccel();
+    }
+    return adxlStats.bytes - bytes;
+}
+
+static void testPolicy(void)
+{
+    ACCEL_LOAD_t load;
+    uint32_t walking, resting;
+
+    start();
+    CHECK((adxl_peek(REG_BW_RATE) & 0x0F) == accelRates[ACCEL_RATE_12HZ5].code);
+    runSeconds(2);
+    CHECK(movementDetected);
+    CHECK((adxl_peek(REG_BW_RATE) & 0x0F) == accelRates[ACCEL_RATE_25HZ].code);
+    runSeconds(8);
+    walking = runSeconds(20);
+    getAccelLoad(&load);
+    CHECK(load.rate == ACCEL_RATE_25HZ);
+    CHECK(walking / 20 <= load.busBytesPerSecond * 11 / 10);
+    CHECK(walking / 20 >= load.busBytesPerSecond * 9 / 10);
+    printf("25 Hz walking: %lu bus bytes/s, estimated %u\n",
+           (unsigned long)walking / 20, load.busBytesPerSecond);
+
+    /* inactivity needs INACT_SECONDS at rest, plus the second to read it */
+    runSeconds(INACT_SECONDS + 2);
+    CHECK(!movementDetected);
+    CHECK((adxl_peek(REG_BW_RATE) & 0x0F) == accelRates[ACCEL_RATE_12HZ5].code);
+    CHECK(adxl_peek(REG_BW_RATE) & LOW_POWER);
+    resting = runSeconds(20);
+    getAccelLoad(&load);
+    CHECK(load.rate == ACCEL_RATE_12HZ5 && load.lowPower);
+    CHECK(resting / 20 == load.busBytesPerSecond);
+    printf("12.5 Hz resting: %lu bus bytes/s, estimated %u\n",
+           (unsigned long)resting / 20, load.busBytesPerSecond);
+}
+
+int main(void)
+{
+    testRates();
+    testSampling();
+    testPolicy();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,143 @@
+/*
+ * Tap input against the ADXL345 model, polled as the set-time and
+ * set-date pages do, once per 50 ms pass: a single tap, a double tap,
+ * two taps too far apart, a tap from before the page opened, and the
+ * pedometer's FIFO left alone while the page runs at 100 Hz.
+ *
+ * host-sources: test/host/adxl345.c System/system.c System/clock.c System/delay.c
+ * host-sources: spiDriver/spi1_driver.c oledDriver/pin_manager.c oledDriver/oledC.c
+ * host-sources: oledDriver/oledC_shapes.c oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c
+ * host-sources: oledDriver/oledC_shadow.c oledDriver/oledC_scanline.c oledDriver/oledC_sprite.c
+ * host-sources: oledDriver/oledC_displayList.c
+ */
+
+#include <stdio.h>
+#include "adxl345.h"
+#include "check.h"
+
+#define main app_main
+#define printf(...) ((void)0)
+#include "main.c"
+#undef printf
+#undef main
+
+#define PAGE_PASSES 80 /* 4 s of 50 ms passes */
+#define NO_TAP 0xFFFFFFFFUL
+
+static uint32_t tapAt[2];
+static bool walking;
+
+/* Flat on a desk, or walking; each tap is 3.6 g on Z for 10 ms */
+static adxl_sample_t taps(uint32_t us)
+{
+    adxl_sample_t s = { 10, -5, 256 };
+    uint8_t n;
+
+    if(walking && us % 500000 < 120000)
+    {
+        s.z += 150;
+    }
+    for(n = 0; n < 2; n++)
+    {
+        if(tapAt[n] != NO_TAP && us >= tapAt[n] && us < tapAt[n] + 10000)
+        {
+            s.z += 900;
+        }
+    }
+    return s;
+}
+
+static void start(uint32_t first, uint32_t second)
+{
+    tapAt[0] = first;
+    tapAt[1] = second;
+    walking = false;
+    adxl_reset();
+    adxl_setSource(taps);
+    initAccelerometer();
+    movementDetected = false;
+    accelEvents = 0;
+    adxl_run(2000000);
+}
+
+/* Runs a page from 2 s on; the first event, and when it came in *us */
+static TAP_EVENT_t runPage(uint32_t *us)
+{
+    TAP_EVENT_t event = TAP_NONE;
+    uint8_t pass;
+
+    setTapInput(true);
+    CHECK(adxl_peek(REG_BW_RATE) == (TAP_RATE_100HZ | LOW_POWER));
+    for(pass = 0; pass < PAGE_PASSES && event == TAP_NONE; pass++)
+    {
+        event = takeTapEvent();
+        *us = adxl_now();
+        adxl_run(50000);
+    }
+    setTapInput(false);
+    return event;
+}
+
+static void testDecoding(void)
+{
+    uint32_t us, transactions;
+
+    start(NO_TAP, NO_TAP);
+    transactions = adxlStats.transactions;
+    CHECK(runPage(&us) == TAP_NONE);
+    /* one INT_SOURCE read every TAP_POLL_PASSES passes */
+    CHECK(adxlStats.transactions - transactions <= PAGE_PASSES / TAP_POLL_PASSES + 12);
+
+    start(3000000, NO_TAP);
+    CHECK(runPage(&us) == TAP_SINGLE);
+    /* decided once LATENT and WINDOW have run out, within 800 ms */
+    CHECK(us > 3000000 + (TAP_LATENCY + TAP_WINDOW) * 1250UL && us < 3800000);
+
+    start(3000000, 3200000);
+    CHECK(runPage(&us) == TAP_DOUBLE);
+    CHECK(us > 3200000 && us < 3500000);
+
+    /* the second tap is past LATENT + WINDOW, so the first stands alone */
+    start(3000000, 3700000);
+    CHECK(runPage(&us) == TAP_SINGLE);
+    CHECK(us < 3700000 + 200000);
+
+    /* tapped before the page opened */
+    start(1000000, NO_TAP);
+    CHECK(runPage(&us) == TAP_NONE);
+}
+
+static void testPedometerFifo(void)
+{
+    uint32_t us, overruns;
+    uint16_t pass;
+
+    start(NO_TAP, NO_TAP);
+    walking = true;
+    for(pass = 0; pass < 3; pass++)
+    {
+        adxl_run(1000000);
+        serviceAccel();
+    }
+    CHECK(movementDetected);
+    overruns = adxlStats.overruns;
+    CHECK(runPage(&us) == TAP_NONE);
+    /* the page's 100 Hz samples never queue up behind the pedometer's */
+    CHECK(adxlStats.overruns == overruns);
+    CHECK(adxl_peek(REG_BW_RATE) == (accelRates[ACCEL_RATE_25HZ].code | LOW_POWER));
+    CHECK(adxl_peek(REG_FIFO_CTL) == (FIFO_STREAM | accelRates[ACCEL_RATE_25HZ].watermark));
+    for(pass = 0; pass < 5; pass++)
+    {
+        adxl_run(1000000);
+        serviceAccel();
+    }
+    CHECK(adxlStats.staleReads == 0);
+    CHECK(adxlStats.overruns == overruns);
+}
+
+int main(void)
+{
+    testDecoding();
+    testPedometerFifo();
+    return CHECK_RESULT();
+}
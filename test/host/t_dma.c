@@ -0,0 +1,159 @@
+/*
+ * DMA0 -> SPI1 pixel transfers: one word per SPI1 transmit event, no FIFO
+ * overflow, one completion interrupt per block, and the oledC flush queue
+ * chaining jobs from that interrupt.
+ *
+ * host-sources: spiDriver/spi1_driver.c oledDriver/oledC.c System/delay.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+#include "spiDriver/spi1_driver.h"
+#include "oledDriver/oledC.h"
+#include "sfr_model.h"
+#include "check.h"
+
+#define RUN_WORDS 300u
+#define FILL_WORDS (96u * 96u)
+
+static uint16_t source[RUN_WORDS];
+static uint16_t shifted[FILL_WORDS + 256];
+static int completions;
+
+static void countCompletion(void)
+{
+    completions++;
+}
+
+static void openForDma(void)
+{
+    sfr_reset();
+    sfr_capture(shifted, sizeof shifted / sizeof shifted[0]);
+    completions = 0;
+    spi1_setSpiISR(countCompletion);
+    CHECK(spi1_openWordWriter());
+}
+
+static void testRun(void)
+{
+    uint16_t n;
+    bool same = true;
+
+    for(n = 0; n < RUN_WORDS; n++)
+    {
+        source[n] = 0x1000 + n;
+    }
+    openForDma();
+    CHECK(spi1_dmaWriteWords(source, RUN_WORDS, true));
+    CHECK(spi1_dmaIsBusy());
+    CHECK(!spi1_dmaWriteWords(source, RUN_WORDS, true));
+    CHECK(sfr_runUntilIdle(RUN_WORDS * 40));
+    for(n = 0; n < RUN_WORDS; n++)
+    {
+        same = same && shifted[n] == source[n];
+    }
+    CHECK(same);
+    CHECK(sfrStats.shifted == RUN_WORDS);
+    CHECK(sfrStats.txLost == 0);
+    CHECK(sfrStats.txPeak <= 2);
+    /* the first word is primed by the CPU, the rest follow TX events */
+    CHECK(sfrStats.dmaTransfers == RUN_WORDS - 1);
+    CHECK(sfrStats.dmaTriggers == RUN_WORDS - 1);
+    CHECK(sfrStats.dmaBadAddress == 0);
+    CHECK(sfrStats.dmaDone == 1);
+    CHECK(sfrStats.dmaInterrupts == 1);
+    CHECK(completions == 1);
+    CHECK(!spi1_dmaIsBusy());
+    CHECK(!DMACH0bits.CHEN);
+    CHECK(!SPI1IMSKLbits.SPITBEN);
+}
+
+static void testRepeat(void)
+{
+    uint16_t n;
+    bool same = true;
+
+    source[0] = 0xF81F;
+    openForDma();
+    CHECK(spi1_dmaWriteWords(source, FILL_WORDS, false));
+    CHECK(sfr_runUntilIdle(FILL_WORDS * 40));
+    for(n = 0; n < FILL_WORDS; n++)
+    {
+        same = same && shifted[n] == 0xF81F;
+    }
+    CHECK(same);
+    CHECK(sfrStats.shifted == FILL_WORDS);
+    CHECK(sfrStats.txLost == 0);
+    CHECK(completions == 1);
+    /* SCK bound: 32 Tcy per word at SPI1BRGL = 0 */
+    CHECK(sfrStats.cycles < FILL_WORDS * 32 + 64);
+    printf("DMA 96x96 fill: %lu Tcy, %lu triggers\n",
+           (unsigned long)sfrStats.cycles, (unsigned long)sfrStats.dmaTriggers);
+}
+
+static void testRefusals(void)
+{
+    openForDma();
+    CHECK(!spi1_dmaWriteWords(source, 0, true));
+    CHECK(!spi1_dmaWriteWords(source, 1, true));
+    spi1_close();
+    CHECK(spi1_open());
+    CHECK(!spi1_dmaWriteWords(source, RUN_WORDS, true)); /* byte mode */
+    CHECK(sfrStats.dmaTransfers == 0);
+}
+
+/* What a continuous-mode block does to the same FIFO: it overruns */
+static void testContinuousOverruns(void)
+{
+    openForDma();
+    DMACONbits.DMAEN = 1;
+    DMACH0 = 0;
+    DMACH0bits.TRMODE = 2;
+    DMACH0bits.SAMODE = 1;
+    DMASRC0 = (uintptr_t)source;
+    DMADST0 = (uintptr_t)&SPI1BUFL;
+    DMACNT0 = RUN_WORDS;
+    DMACH0bits.CHEN = 1;
+    DMACH0bits.CHREQ = 1;
+    CHECK(sfr_runUntilIdle(RUN_WORDS * 40));
+    CHECK(sfrStats.txLost > 0);
+    CHECK(sfrStats.shifted < RUN_WORDS);
+}
+
+static void testFlushQueue(void)
+{
+    oledc_flush_job_t job = {10, 10, 19, 19, NULL, 0x07E0, countCompletion};
+    uint16_t n;
+    bool same = true;
+
+    sfr_reset();
+    oledC_setup();
+    oledC_setBackground(0x001F); /* queues the full-screen job */
+    CHECK(oledC_isFlushing());
+    completions = 0;
+    CHECK(oledC_queueFlush(&job)); /* waits behind the clear */
+    sfr_capture(shifted, sizeof shifted / sizeof shifted[0]);
+    CHECK(sfr_runUntilIdle(2 * FILL_WORDS * 40));
+    CHECK(!oledC_isFlushing());
+    CHECK(completions == 1);
+    CHECK(sfrStats.dmaDone == 2);
+    CHECK(sfrStats.dmaInterrupts == 2);
+    CHECK(sfrStats.txLost == 0);
+    /* the tail of the clear is followed by the window commands and 100 greens */
+    for(n = sfrStats.shifted - 100; n < sfrStats.shifted; n++)
+    {
+        same = same && shifted[n] == 0x07E0;
+    }
+    CHECK(same);
+}
+
+int main(void)
+{
+    testRun();
+    testRepeat();
+    testRefusals();
+    testContinuousOverruns();
+    testFlushQueue();
+    return CHECK_RESULT();
+}
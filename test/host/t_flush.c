@@ -0,0 +1,171 @@
+/*
+ * Shadow and frame flushes on the SSD1351 panel model. Random scenes are
+ * drawn through each buffer and the decoded panel image is compared with
+ * the same scene rendered into a canvas target. Both flushes send their
+ * rows as DMA jobs from the driver's row buffers and return while the
+ * last ones are still going out, so a row buffer reused too early shows
+ * up as a wrong pixel.
+ *
+ * host-sources: spiDriver/spi1_driver.c oledDriver/oledC.c oledDriver/oledC_shapes.c
+ * host-sources: oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c oledDriver/oledC_shadow.c
+ * host-sources: oledDriver/oledC_frame.c System/delay.c test/host/panel_model.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xc.h>
+#include "oledDriver/oledC.h"
+#include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_shadow.h"
+#include "oledDriver/oledC_frame.h"
+#include "sfr_model.h"
+#include "panel_model.h"
+#include "check.h"
+
+#define INK 0xFFFF
+#define PAPER 0x0000
+
+static uint16_t canvas[PANEL_DIM][PANEL_DIM];
+
+static void canvasFill(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t x, y;
+
+    for(y = start_y; y <= end_y; y++)
+    {
+        for(x = start_x; x <= end_x; x++)
+        {
+            canvas[y][x] = color;
+        }
+    }
+}
+
+static const oledc_target_t canvasTarget = { canvasFill };
+
+static void settle(void)
+{
+    CHECK(sfr_runUntilIdle(10000000));
+}
+
+/* A few shapes from seed, in colours picked from colors[] */
+static void drawScene(unsigned seed, const uint16_t *colors, uint8_t colorCount)
+{
+    uint8_t i, shapes;
+
+    srand(seed);
+    shapes = 2 + rand() % 6;
+    for(i = 0; i < shapes; i++)
+    {
+        uint8_t x0 = rand() % PANEL_DIM, y0 = rand() % PANEL_DIM;
+        uint8_t x1 = rand() % PANEL_DIM, y1 = rand() % PANEL_DIM;
+        uint16_t color = colors[rand() % colorCount];
+        switch(rand() % 4)
+        {
+            case 0:
+                oledC_DrawRectangle(x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                    x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, color);
+                break;
+            case 1:
+                oledC_DrawLine(x0, y0, x1, y1, 1 + rand() % 4, color);
+                break;
+            case 2:
+                oledC_DrawCircle(x0, y0, 2 + rand() % 30, color);
+                break;
+            default:
+                oledC_DrawRing(x0, y0, 4 + rand() % 30, 1 + rand() % 4, color);
+                break;
+        }
+    }
+}
+
+static void drawCanvas(unsigned seed, const uint16_t *colors, uint8_t colorCount, uint16_t background)
+{
+    const oledc_target_t *previous = oledC_setTarget(&canvasTarget);
+
+    canvasFill(0, 0, PANEL_DIM - 1, PANEL_DIM - 1, background);
+    drawScene(seed, colors, colorCount);
+    oledC_setTarget(previous);
+}
+
+static bool writtenOnce(void)
+{
+    uint8_t x, y;
+
+    for(y = 0; y < PANEL_DIM; y++)
+    {
+        for(x = 0; x < PANEL_DIM; x++)
+        {
+            if(panelWrites[y][x] != 1)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* Each frame replaces the last: the shadow must send what changed */
+static void testShadow(void)
+{
+    static const uint16_t ink[] = { INK };
+    oledc_shadow_stats_t stats;
+    unsigned frame;
+    bool overlapped = false;
+
+    settle();
+    panel_reset(PAPER);
+    oledC_shadowReset(INK, PAPER);
+    for(frame = 0; frame < 40; frame++)
+    {
+        oledC_shadowBegin();
+        oledC_DrawRectangle(0, 0, PANEL_DIM - 1, PANEL_DIM - 1, PAPER);
+        drawScene(100 + frame, ink, 1);
+        oledC_shadowEnd();
+        overlapped = overlapped || oledC_isFlushing();
+        settle();
+        drawCanvas(100 + frame, ink, 1, PAPER);
+        CHECK(memcmp(panelImage, canvas, sizeof canvas) == 0);
+        oledC_shadowGetStats(&stats);
+        CHECK(stats.rects == 0 || stats.pixels > 0);
+    }
+    CHECK(overlapped);
+}
+
+/* The frame goes out whole, every pixel exactly once */
+static void testFrame(void)
+{
+    static const uint16_t colors[] = { 0xFFFF, 0xF800, 0x07E0, 0x001F, 0xFFE0, 0x8410 };
+    unsigned frame;
+
+    for(frame = 0; frame < 20; frame++)
+    {
+        settle();
+        panel_clearCounts();
+        oledC_frameClear(0x0000);
+        oledC_frameBegin();
+        drawScene(200 + frame, colors, sizeof colors / sizeof colors[0]);
+        oledC_frameEnd();
+        CHECK(oledC_isFlushing());
+        settle();
+        drawCanvas(200 + frame, colors, sizeof colors / sizeof colors[0], 0x0000);
+        CHECK(memcmp(panelImage, canvas, sizeof canvas) == 0);
+        CHECK(writtenOnce());
+    }
+}
+
+int main(void)
+{
+    sfr_reset();
+    panel_reset(PAPER);
+    oledC_setup();
+    testShadow();
+    testFrame();
+    CHECK(panelStats.outside == 0);
+    CHECK(panelStats.deselected == 0);
+    CHECK(panelStats.strayData == 0);
+    CHECK(sfrStats.txLost == 0);
+    return CHECK_RESULT();
+}
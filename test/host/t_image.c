@@ -0,0 +1,116 @@
+/*
+ * Compressed image draw time against a raw RGB565 blit of the same pixels,
+ * for the samples in tools/samples. Decoder output is checked pixel for
+ * pixel through a render target first. Only SPI1 register and bus time is
+ * modelled; the decoder's own CPU time between pushes is not counted.
+ *
+ * host-sources: spiDriver/spi1_driver.c oledDriver/oledC.c oledDriver/oledC_image.c
+ * host-sources: oledDriver/oledC_shapes.c oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c
+ * host-sources: System/delay.c sample_images.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+#include "oledDriver/oledC.h"
+#include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_image.h"
+#include "sample_images.h"
+#include "sfr_model.h"
+#include "check.h"
+
+typedef struct
+{
+    const char *name;
+    const oledc_image_t *image;
+    const uint16_t *raw;
+} sample_t;
+
+static const sample_t samples[] = {
+    { "logo", &logo, logoRaw },
+    { "face", &face, faceRaw },
+    { "vgrad", &vgrad, vgradRaw },
+    { "xygrad", &xygrad, xygradRaw },
+    { "noise", &noise, noiseRaw },
+};
+
+static uint16_t canvas[96][96];
+
+static void canvasFill(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t x, y;
+
+    for(y = start_y; y <= end_y; y++)
+    {
+        for(x = start_x; x <= end_x; x++)
+        {
+            canvas[y][x] = color;
+        }
+    }
+}
+
+static const oledc_target_t canvasTarget = { canvasFill };
+
+static bool decodesExactly(const sample_t *sample)
+{
+    uint8_t x, y;
+    bool same = true;
+
+    oledC_setTarget(&canvasTarget);
+    oledC_DrawImage(0, 0, sample->image);
+    oledC_setTarget(NULL);
+    for(y = 0; y < sample->image->height; y++)
+    {
+        for(x = 0; x < sample->image->width; x++)
+        {
+            same = same && canvas[y][x] == sample->raw[y * sample->image->width + x];
+        }
+    }
+    return same;
+}
+
+static uint32_t timeImage(const sample_t *sample)
+{
+    uint32_t start;
+
+    oledC_invalidateWindow();
+    start = sfrStats.cycles;
+    oledC_DrawImage(0, 0, sample->image);
+    CHECK(sfr_runUntilIdle(1000000));
+    return sfrStats.cycles - start;
+}
+
+static uint32_t timeRaw(const sample_t *sample)
+{
+    uint32_t start;
+
+    oledC_invalidateWindow();
+    start = sfrStats.cycles;
+    oledC_beginWindow(0, 0, sample->image->width - 1, sample->image->height - 1);
+    oledC_pushColors(sample->raw, (uint16_t)sample->image->width * sample->image->height);
+    oledC_endWindow();
+    CHECK(sfr_runUntilIdle(1000000));
+    return sfrStats.cycles - start;
+}
+
+int main(void)
+{
+    uint8_t n;
+    uint32_t rle, raw;
+
+    sfr_reset();
+    oledC_setup();
+    CHECK(sfr_runUntilIdle(1000000));
+    printf("image      Tcy RLE   Tcy raw\n");
+    for(n = 0; n < sizeof samples / sizeof samples[0]; n++)
+    {
+        CHECK(decodesExactly(&samples[n]));
+        rle = timeImage(&samples[n]);
+        raw = timeRaw(&samples[n]);
+        printf("%-8s %9lu %9lu\n", samples[n].name, (unsigned long)rle, (unsigned long)raw);
+        /* the same pixels over the same bus, so the same bus time */
+        CHECK(rle < raw + raw / 50);
+    }
+    CHECK(sfrStats.txLost == 0);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,109 @@
+/*
+ * Display list equivalence: random command lists are drawn straight into
+ * a capture target and again between oledC_listBegin() and oledC_listEnd()
+ * into a second one. Dropping, merging and reordering must leave the two
+ * images identical, including lists long enough to fill the arena and
+ * flush early.
+ *
+ * host-sources: spiDriver/spi1_driver.c oledDriver/oledC.c oledDriver/oledC_shapes.c
+ * host-sources: oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c oledDriver/oledC_displayList.c
+ * host-sources: System/delay.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xc.h>
+#include "oledDriver/oledC.h"
+#include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_displayList.h"
+#include "sfr_model.h"
+#include "check.h"
+
+#define DIM 96
+
+static uint16_t direct[DIM][DIM];
+static uint16_t listed[DIM][DIM];
+static uint16_t (*canvas)[DIM] = direct;
+
+static void canvasFill(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y, uint16_t color)
+{
+    uint8_t x, y;
+
+    for(y = start_y; y <= end_y; y++)
+    {
+        for(x = start_x; x <= end_x; x++)
+        {
+            canvas[y][x] = color;
+        }
+    }
+}
+
+static const oledc_target_t canvasTarget = { canvasFill };
+
+/* Few colours, so neighbours often match and merge */
+static const uint16_t colors[] = { 0x0000, 0xFFFF, 0xF800, 0x07E0 };
+
+static void drawCommands(unsigned seed, uint16_t count)
+{
+    uint16_t i;
+
+    srand(seed);
+    for(i = 0; i < count; i++)
+    {
+        uint8_t x0 = rand() % DIM, y0 = rand() % DIM;
+        uint8_t x1 = x0 + rand() % 24, y1 = y0 + rand() % 24;
+        uint16_t color = colors[rand() % 4];
+        switch(rand() % 5)
+        {
+            case 0:
+            case 1:
+                oledC_DrawRectangle(x0, y0, x1, y1, color);
+                break;
+            case 2:
+                oledC_DrawLine(x0, y0, rand() % DIM, rand() % DIM, 1 + rand() % 3, color);
+                break;
+            case 3:
+                oledC_DrawCircle(x0, y0, 1 + rand() % 12, color);
+                break;
+            default:
+                oledC_DrawCharacter(x0, y0, 1 + rand() % 2, 1 + rand() % 2, 'A' + rand() % 26, color);
+                break;
+        }
+    }
+}
+
+int main(void)
+{
+    oledc_list_stats_t stats;
+    unsigned seed;
+    uint16_t count;
+    bool earlyFlush = false;
+
+    sfr_reset();
+    oledC_setup();
+    oledC_setTarget(&canvasTarget);
+    for(seed = 0; seed < 200; seed++)
+    {
+        count = 1 + seed % 60;
+        memset(direct, 0, sizeof direct);
+        memset(listed, 0, sizeof listed);
+
+        canvas = direct;
+        drawCommands(seed, count);
+
+        canvas = listed;
+        oledC_listBegin();
+        drawCommands(seed, count);
+        oledC_listEnd();
+
+        CHECK(memcmp(direct, listed, sizeof direct) == 0);
+        oledC_listGetStats(&stats);
+        CHECK(stats.sent + stats.dropped + stats.merged == stats.recorded);
+        earlyFlush = earlyFlush || stats.flushes > 1;
+    }
+    CHECK(earlyFlush);
+    oledC_setTarget(NULL);
+    return CHECK_RESULT();
+}
@@ -0,0 +1,463 @@
+/*
+ * Lines, polylines, circles, rings, arcs and point sets on the SSD1351
+ * panel model. Each primitive is drawn over SPI1 and the decoded panel
+ * image is compared with a reference: an independent rasterisation for
+ * lines and the band shapes, the same points plotted one at a time with
+ * oledC_DrawPoint() for point sets. Shapes are also rendered through the
+ * scanline renderer's per-row paths and compared with the same reference.
+ *
+ * host-sources: spiDriver/spi1_driver.c oledDriver/oledC.c oledDriver/oledC_shapes.c
+ * host-sources: oledDriver/oledC_fonts.c oledDriver/oledC_fontData.c oledDriver/oledC_image.c
+ * host-sources: oledDriver/oledC_scanline.c System/delay.c test/host/panel_model.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <xc.h>
+#include "oledDriver/oledC.h"
+#include "oledDriver/oledC_shapes.h"
+#include "oledDriver/oledC_scanline.h"
+#include "sfr_model.h"
+#include "panel_model.h"
+#include "check.h"
+
+#define INK 0xFFFF
+#define PAPER 0x0000
+
+static uint16_t expected[PANEL_DIM][PANEL_DIM];
+static uint8_t vx[64], vy[64];
+
+static void settle(void)
+{
+    CHECK(sfr_runUntilIdle(10000000));
+}
+
+/* Blanks the panel image only; the driver's window state is kept */
+static void blankPanel(void)
+{
+    uint8_t x, y;
+
+    settle();
+    for(y = 0; y < PANEL_DIM; y++)
+    {
+        for(x = 0; x < PANEL_DIM; x++)
+        {
+            panelImage[y][x] = PAPER;
+        }
+    }
+    panel_clearCounts();
+}
+
+static void blank(void)
+{
+    blankPanel();
+    memset(expected, 0, sizeof expected);
+}
+
+static void expect(int16_t x, int16_t y)
+{
+    if(x >= 0 && y >= 0 && x < PANEL_DIM && y < PANEL_DIM)
+    {
+        expected[y][x] = INK;
+    }
+}
+
+static bool matchesExpected(void)
+{
+    settle();
+    return memcmp(panelImage, expected, sizeof expected) == 0;
+}
+
+static bool writtenOnce(void)
+{
+    uint8_t x, y;
+
+    for(y = 0; y < PANEL_DIM; y++)
+    {
+        for(x = 0; x < PANEL_DIM; x++)
+        {
+            if(panelWrites[y][x] > 1)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/* The shape rendered row by row over its bounds must give the same */
+static bool scanlineMatches(shape_t *shape)
+{
+    oledc_rect_t bounds;
+
+    blankPanel();
+    if(!oledC_getShapeBounds(shape, &bounds))
+    {
+        return memcmp(panelImage, expected, sizeof expected) == 0;
+    }
+    oledC_scanlineRender(&bounds, shape, 1, PAPER);
+    return matchesExpected() && writtenOnce();
+}
+
+/* Textbook Bresenham; a thick line spans width pixels across the minor axis */
+static void referenceLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width)
+{
+    int16_t dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int16_t dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int16_t err = dx + dy, e2, k;
+    int16_t lo, hi;
+    bool steep = -dy > dx;
+
+    width = width <= 1 ? 1 : width;
+    lo = (width - 1) / 2;
+    hi = width / 2;
+    for(;;)
+    {
+        for(k = -lo; k <= hi; k++)
+        {
+            expect(steep ? x0 + k : x0, steep ? y0 : y0 + k);
+        }
+        if(x0 == x1 && y0 == y1)
+        {
+            break;
+        }
+        e2 = 2 * err;
+        if(e2 >= dy)
+        {
+            err += dy;
+            x0 += sx;
+        }
+        if(e2 <= dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+/* Every octant, the axes and the diagonals, both directions, four widths */
+static void testLines(void)
+{
+    uint16_t angle;
+    uint8_t width, x1, y1;
+    shape_t shape;
+    shape_params_t params;
+
+    for(width = 1; width <= 4; width++)
+    {
+        for(angle = 0; angle < 360; angle += 5)
+        {
+            x1 = (uint8_t)lround(48 + 45 * cos(angle * M_PI / 180));
+            y1 = (uint8_t)lround(48 + 45 * sin(angle * M_PI / 180));
+            blank();
+            referenceLine(48, 48, x1, y1, width);
+            oledC_DrawLine(48, 48, x1, y1, width, INK);
+            CHECK(matchesExpected());
+            CHECK(width > 1 || writtenOnce());
+
+            blank();
+            referenceLine(x1, y1, 48, 48, width);
+            oledC_DrawLine(x1, y1, 48, 48, width, INK);
+            CHECK(matchesExpected());
+
+            params.line.color = INK;
+            params.line.xs = x1;
+            params.line.ys = y1;
+            params.line.xe = 48;
+            params.line.ye = 48;
+            params.line.width = width;
+            oledC_createShape(OLED_SHAPE_LINE, &params, &shape);
+            CHECK(scanlineMatches(&shape));
+        }
+    }
+    /* corner to corner, thick spans clipped at the panel edges */
+    blank();
+    referenceLine(0, 0, 95, 95, 3);
+    referenceLine(0, 95, 95, 0, 4);
+    referenceLine(0, 1, 95, 2, 3);
+    oledC_DrawLine(0, 0, 95, 95, 3, INK);
+    oledC_DrawLine(0, 95, 95, 0, 4, INK);
+    oledC_DrawLine(0, 1, 95, 2, 3, INK);
+    CHECK(matchesExpected());
+    /* a single point */
+    blank();
+    referenceLine(7, 9, 7, 9, 1);
+    oledC_DrawLine(7, 9, 7, 9, 1, INK);
+    CHECK(matchesExpected());
+}
+
+static void testPolylines(void)
+{
+    uint8_t n, i, count, width;
+    shape_t shape;
+    shape_params_t params;
+
+    srand(11);
+    for(n = 0; n < 40; n++)
+    {
+        count = 1 + rand() % 12;
+        width = 1 + rand() % 3;
+        for(i = 0; i < count; i++)
+        {
+            vx[i] = rand() % PANEL_DIM;
+            vy[i] = rand() % PANEL_DIM;
+        }
+        blank();
+        if(count == 1)
+        {
+            referenceLine(vx[0], vy[0], vx[0], vy[0], width);
+        }
+        for(i = 1; i < count; i++)
+        {
+            referenceLine(vx[i - 1], vy[i - 1], vx[i], vy[i], width);
+        }
+        oledC_DrawPolyline(vx, vy, count, width, INK);
+        CHECK(matchesExpected());
+
+        params.polyline.color = INK;
+        params.polyline.x = vx;
+        params.polyline.y = vy;
+        params.polyline.count = count;
+        params.polyline.width = width;
+        oledC_createShape(OLED_SHAPE_POLYLINE, &params, &shape);
+        CHECK(scanlineMatches(&shape));
+    }
+}
+
+/* Inside when the pixel centre is within r + 1/2: d^2 <= r^2 + r */
+static bool withinRadius(int16_t dx, int16_t dy, int16_t r)
+{
+    return r >= 0 && (int32_t)dx * dx + (int32_t)dy * dy <= (int32_t)r * r + r;
+}
+
+static void referenceBand(int16_t x0, int16_t y0, int16_t outer, int16_t inner)
+{
+    int16_t x, y;
+
+    for(y = 0; y < PANEL_DIM; y++)
+    {
+        for(x = 0; x < PANEL_DIM; x++)
+        {
+            if(withinRadius(x - x0, y - y0, outer) && !withinRadius(x - x0, y - y0, inner))
+            {
+                expect(x, y);
+            }
+        }
+    }
+}
+
+static void testCirclesAndRings(void)
+{
+    static const uint8_t centres[][2] = { {48, 48}, {5, 90}, {90, 3}, {0, 0}, {60, 95} };
+    uint8_t c, radius, width;
+    shape_t shape;
+    shape_params_t params;
+
+    for(c = 0; c < sizeof centres / sizeof centres[0]; c++)
+    {
+        for(radius = 0; radius <= 50; radius += radius < 8 ? 1 : 7)
+        {
+            uint8_t x0 = centres[c][0], y0 = centres[c][1];
+
+            blank();
+            referenceBand(x0, y0, radius <= 1 ? 1 : radius, -1);
+            oledC_DrawCircle(x0, y0, radius, INK);
+            CHECK(matchesExpected());
+            CHECK(writtenOnce());
+            params.circle.color = INK;
+            params.circle.xc = x0;
+            params.circle.yc = y0;
+            params.circle.radius = radius;
+            oledC_createShape(OLED_SHAPE_CIRCLE, &params, &shape);
+            CHECK(scanlineMatches(&shape));
+
+            for(width = 1; width <= 6 && width <= radius; width += 2)
+            {
+                int16_t outer = radius + (width >> 1);
+                blank();
+                referenceBand(x0, y0, outer, outer - width);
+                oledC_DrawRing(x0, y0, radius, width, INK);
+                CHECK(matchesExpected());
+                CHECK(writtenOnce());
+                params.ring.color = INK;
+                params.ring.x0 = x0;
+                params.ring.y0 = y0;
+                params.ring.radius = radius;
+                params.ring.width = width;
+                oledC_createShape(OLED_SHAPE_RING, &params, &shape);
+                CHECK(scanlineMatches(&shape));
+            }
+        }
+    }
+}
+
+/* Degrees clockwise from 12 o'clock, y down */
+static double pixelAngle(int16_t dx, int16_t dy)
+{
+    double a = atan2(dx, -dy) * 180 / M_PI;
+    return a < 0 ? a + 360 : a;
+}
+
+/* Angular distance from a into [start, end) going clockwise; 0 inside */
+static double outsideBy(double a, double start, double end)
+{
+    double sweep = fmod(end - start + 360, 360), off = fmod(a - start + 360, 360);
+    double before = 360 - off, after = off - sweep;
+
+    if(sweep == 0)
+    {
+        sweep = 360;
+    }
+    if(off < sweep)
+    {
+        return 0;
+    }
+    return before < after ? before : after;
+}
+
+/*
+ * Arcs: pixels well inside the sector are drawn, pixels well outside are
+ * not, and arcs sharing end angles tile the ring exactly, each pixel once.
+ */
+static void testArcs(void)
+{
+    static const uint16_t cuts[] = { 0, 37, 90, 145, 181, 200, 271, 333, 359 };
+    uint8_t i, n, radius = 30, width = 9;
+    int16_t outer = radius + (width >> 1), x, y;
+    shape_t shape;
+    shape_params_t params;
+
+    for(i = 0; i < sizeof cuts / sizeof cuts[0]; i++)
+    {
+        for(n = 0; n < sizeof cuts / sizeof cuts[0]; n++)
+        {
+            uint16_t start = cuts[i], end = cuts[n];
+            if(start == end)
+            {
+                continue;
+            }
+            blank();
+            oledC_DrawArc(48, 48, radius, width, start, end, INK);
+            settle();
+            CHECK(writtenOnce());
+            for(y = 0; y < PANEL_DIM; y++)
+            {
+                for(x = 0; x < PANEL_DIM; x++)
+                {
+                    bool inBand = withinRadius(x - 48, y - 48, outer) && !withinRadius(x - 48, y - 48, outer - width);
+                    double a = pixelAngle(x - 48, y - 48);
+                    double off = outsideBy(a, start, end);
+                    bool wellInside = off == 0 && fmod(a - start + 360, 360) >= 1 && fmod(end - a + 360, 360) >= 1;
+                    if(panelImage[y][x] == INK)
+                    {
+                        CHECK(inBand && off < 1);
+                        expected[y][x] = INK;
+                    }
+                    else
+                    {
+                        CHECK(!(inBand && wellInside));
+                    }
+                }
+            }
+            params.arc.color = INK;
+            params.arc.x0 = 48;
+            params.arc.y0 = 48;
+            params.arc.radius = radius;
+            params.arc.width = width;
+            params.arc.start = start;
+            params.arc.end = end;
+            oledC_createShape(OLED_SHAPE_ARC, &params, &shape);
+            CHECK(scanlineMatches(&shape));
+        }
+    }
+
+    /* the cuts in order tile the ring */
+    blank();
+    referenceBand(48, 48, outer, outer - width);
+    for(i = 0; i < sizeof cuts / sizeof cuts[0]; i++)
+    {
+        oledC_DrawArc(48, 48, radius, width, cuts[i], cuts[(i + 1) % (sizeof cuts / sizeof cuts[0])], INK);
+    }
+    CHECK(matchesExpected());
+    CHECK(writtenOnce());
+}
+
+static uint32_t drawPointsOneByOne(const uint8_t *x, const uint8_t *y, uint8_t count)
+{
+    uint8_t i;
+
+    blank();
+    for(i = 0; i < count; i++)
+    {
+        oledC_DrawPoint(x[i], y[i], INK);
+    }
+    settle();
+    memcpy(expected, panelImage, sizeof expected);
+    return panel_bytes();
+}
+
+/* Scattered sets with repeats, a row-major scan, a column trace */
+static void testPoints(void)
+{
+    static uint8_t px[200], py[200];
+    uint8_t n, i, count;
+    uint32_t single, sorted, singleTotal = 0, sortedTotal = 0;
+
+    srand(20);
+    for(n = 0; n < 60; n++)
+    {
+        count = 1 + rand() % 200;
+        for(i = 0; i < count; i++)
+        {
+            switch(n % 3)
+            {
+                case 0: /* scattered, some repeated */
+                    px[i] = i > 0 && rand() % 8 == 0 ? px[rand() % i] : rand() % PANEL_DIM;
+                    py[i] = i > 0 && rand() % 8 == 0 ? py[i - 1] : rand() % PANEL_DIM;
+                    break;
+                case 1: /* clustered in a few rows */
+                    px[i] = 20 + rand() % 40;
+                    py[i] = 40 + rand() % 4;
+                    break;
+                default: /* a trace, one column per point */
+                    px[i] = i % PANEL_DIM;
+                    py[i] = 48 + (int8_t)(20 * sin(i / 8.0));
+                    break;
+            }
+        }
+        single = drawPointsOneByOne(px, py, count);
+        blankPanel();
+        oledC_DrawPoints(px, py, count, INK);
+        settle();
+        sorted = panel_bytes();
+        CHECK(memcmp(panelImage, expected, sizeof expected) == 0);
+        CHECK(writtenOnce());
+        singleTotal += single;
+        sortedTotal += sorted;
+    }
+    printf("point sets: %lu bus bytes one by one, %lu through oledC_DrawPoints\n",
+        (unsigned long)singleTotal, (unsigned long)sortedTotal);
+    CHECK(sortedTotal <= singleTotal);
+}
+
+int main(void)
+{
+    sfr_reset();
+    panel_reset(PAPER);
+    oledC_setup();
+    settle();
+    testLines();
+    testPolylines();
+    testCirclesAndRings();
+    testArcs();
+    testPoints();
+    CHECK(panelStats.outside == 0);
+    CHECK(panelStats.deselected == 0);
+    CHECK(panelStats.strayData == 0);
+    CHECK(sfrStats.txLost == 0);
+    return CHECK_RESULT();
+}
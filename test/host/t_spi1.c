@@ -0,0 +1,77 @@
+/*
+ * SPI1 throughput for a 96x96 RGB565 fill at SPI1BRGL = 0 (2 MHz SCK),
+ * comparing the three ways the driver can move pixels.
+ *
+ * host-sources: spiDriver/spi1_driver.c
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+#include "spiDriver/spi1_driver.h"
+#include "sfr_model.h"
+#include "check.h"
+
+#define PIXELS (96u * 96u)
+#define COLOR 0xF81Fu
+/* 16 bits at 2 Tcy per bit: the SCK floor for a full-screen fill */
+#define SCK_FLOOR_TCY (PIXELS * 32u)
+
+/* What the driver did before ENHBUF: wait for every byte to clock back in */
+static uint32_t fillByExchange(void)
+{
+    uint16_t n;
+
+    sfr_reset();
+    SPI1CON1L = 0x8120; /* SPIEN, CKE, MSTEN, standard buffer */
+    for(n = 0; n < PIXELS; n++)
+    {
+        spi1_exchangeByte(COLOR >> 8);
+        spi1_exchangeByte(COLOR & 0xFF);
+    }
+    CHECK(sfrStats.shifted == 2 * PIXELS);
+    return sfrStats.cycles;
+}
+
+static uint32_t fillByByteFifo(void)
+{
+    uint16_t n;
+
+    sfr_reset();
+    CHECK(spi1_open());
+    for(n = 0; n < PIXELS; n++)
+    {
+        spi1_writeByte(COLOR >> 8);
+        spi1_writeByte(COLOR & 0xFF);
+    }
+    spi1_drain();
+    CHECK(sfrStats.shifted == 2 * PIXELS);
+    return sfrStats.cycles;
+}
+
+static uint32_t fillByWordFifo(void)
+{
+    sfr_reset();
+    CHECK(spi1_openWordWriter());
+    spi1_writeWordRepeat(COLOR, PIXELS);
+    spi1_drain();
+    CHECK(sfrStats.shifted == PIXELS);
+    CHECK(sfrStats.txPeak == 8);
+    return sfrStats.cycles;
+}
+
+int main(void)
+{
+    uint32_t exchange = fillByExchange();
+    uint32_t byteFifo = fillByByteFifo();
+    uint32_t wordFifo = fillByWordFifo();
+
+    printf("96x96 fill, Tcy: exchange %lu, byte FIFO %lu, word FIFO %lu (SCK floor %lu)\n",
+           (unsigned long)exchange, (unsigned long)byteFifo, (unsigned long)wordFifo,
+           (unsigned long)SCK_FLOOR_TCY);
+    CHECK(sfrStats.txLost == 0);
+    CHECK(wordFifo < SCK_FLOOR_TCY + SCK_FLOOR_TCY / 50);
+    CHECK(byteFifo < exchange);
+    CHECK(wordFifo <= byteFifo);
+    return CHECK_RESULT();
+}
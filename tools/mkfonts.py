@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+Generates oledDriver/oledC_fontData.c: the pre-rasterised fonts behind
+oledC_fonts.h.
+
+  small   5x7 proportional, cut from the font[] table in oledC_shapes.c
+  medium  the small font pre-scaled 2x (10x14)
+  large   12x21 segment-style numerals '0'..':' for the watch face
+
+Glyph rows are packed MSB-first, (width + 7) / 8 bytes per row, one glyph
+after another; the index holds each glyph's byte offset and width.
+
+Usage: python3 tools/mkfonts.py   (from the repository root)
+"""
+
+import re
+import sys
+
+SHAPES = "oledDriver/oledC_shapes.c"
+OUTPUT = "oledDriver/oledC_fontData.c"
+
+
+def legacy_font():
+    src = open(SHAPES).read()
+    body = re.search(r"static const uint8_t font\[\]\s*=\s*\{(.*?)\};", src, re.S).group(1)
+    body = re.sub(r"//[^\n]*", "", body)
+    data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+    return [data[i:i + 5] for i in range(0, len(data), 5)]
+
+
+def small_glyphs():
+    """Font column bit 7 is the top row; bit 0 is blank in every glyph."""
+    glyphs = {}
+    for index, columns in enumerate(legacy_font()):
+        rows = [[(c >> (7 - r)) & 1 for c in columns] for r in range(7)]
+        used = [x for x in range(5) if any(row[x] for row in rows)]
+        if not used:
+            rows, width = [[0] * 2 for _ in range(7)], 2
+        else:
+            rows = [row[used[0]:used[-1] + 1] for row in rows]
+            width = used[-1] - used[0] + 1
+        glyphs[chr(32 + index)] = rows
+    return glyphs
+
+
+def scaled(glyphs, factor):
+    out = {}
+    for ch, rows in glyphs.items():
+        wide = [[p for p in row for _ in range(factor)] for row in rows]
+        out[ch] = [list(row) for row in wide for _ in range(factor)]
+    return out
+
+
+def large_glyphs():
+    width, height, t = 12, 21, 3
+    mid = height // 2
+    segments = {
+        "a": [(x, y) for y in range(0, t) for x in range(1, width - 1)],
+        "d": [(x, y) for y in range(height - t, height) for x in range(1, width - 1)],
+        "g": [(x, y) for y in range(mid - 1, mid + 2) for x in range(1, width - 1)],
+        "f": [(x, y) for x in range(0, t) for y in range(1, mid + 1)],
+        "e": [(x, y) for x in range(0, t) for y in range(mid, height - 1)],
+        "b": [(x, y) for x in range(width - t, width) for y in range(1, mid + 1)],
+        "c": [(x, y) for x in range(width - t, width) for y in range(mid, height - 1)],
+    }
+    digits = ["abcdef", "bc", "abged", "abgcd", "fgbc", "afgcd", "afgedc", "abc", "abcdefg", "abcdfg"]
+    glyphs = {}
+    for d, segs in enumerate(digits):
+        rows = [[0] * width for _ in range(height)]
+        for s in segs:
+            for x, y in segments[s]:
+                rows[y][x] = 1
+        glyphs[chr(ord("0") + d)] = rows
+    colon = [[0] * 3 for _ in range(height)]
+    for y in list(range(5, 8)) + list(range(height - 8, height - 5)):
+        colon[y] = [1, 1, 1]
+    glyphs[":"] = colon
+    return glyphs
+
+
+def emit(name, glyphs, first, last, spacing, space_width, out):
+    height = len(next(iter(glyphs.values())))
+    bits, index = [], []
+    for code in range(ord(first), ord(last) + 1):
+        rows = glyphs[chr(code)]
+        w = len(rows[0])
+        index.append((len(bits), w))
+        for row in rows:
+            for b in range(0, w, 8):
+                byte = 0
+                for i, p in enumerate(row[b:b + 8]):
+                    byte |= p << (7 - i)
+                bits.append(byte)
+    out.append("static const uint8_t %sBits[%d] = {" % (name, len(bits)))
+    for i in range(0, len(bits), 16):
+        out.append("    " + ",".join("0x%02X" % v for v in bits[i:i + 16]) + ",")
+    out.append("};\n")
+    out.append("static const oledc_glyph_t %sGlyphs[%d] = {" % (name, len(index)))
+    for i in range(0, len(index), 6):
+        out.append("    " + " ".join("{%d,%d}," % e for e in index[i:i + 6]))
+    out.append("};\n")
+    out.append("const oledc_font_t oledC_%s = {" % name)
+    out.append("    %d, 0x%02X, 0x%02X, %d, %d, %sGlyphs, %sBits" %
+               (height, ord(first), ord(last), spacing, space_width, name, name))
+    out.append("};\n")
+
+
+def main():
+    small = small_glyphs()
+    out = [
+        "/*",
+        " * File:   oledC_fontData.c",
+        " *",
+        " * Generated by tools/mkfonts.py - do not edit. The tables are const,",
+        " * so XC16 keeps them in program memory and reads them through PSV.",
+        " */",
+        "",
+        "#include <stdint.h>",
+        '#include "oledC_fonts.h"',
+        "",
+    ]
+    emit("fontSmall", small, " ", "~", 1, 3, out)
+    emit("fontMedium", scaled(small, 2), " ", "~", 2, 6, out)
+    emit("fontLarge", large_glyphs(), "0", ":", 2, 12, out)
+    open(OUTPUT, "w").write("\n".join(out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+"""
+Converts PNG or PPM images into run-length compressed oledc_image_t
+tables for oledC_DrawImage (see oledDriver/oledC_image.h for the format).
+
+Images with at most 16 colours (after RGB565 rounding) are stored as
+OLEDC_IMAGE_RLE4 with a palette, anything else as OLEDC_IMAGE_RLE565.
+Writes <output>.c with the tables and <output>.h with the externs, and
+prints the size against raw RGB565 for every image.
+
+With --raw, each image also gets <name>Raw, its uncompressed RGB565
+pixels, so decoders can be checked and timed against a plain blit.
+tools/samples holds the images used for that in test/host/t_image.c.
+
+Usage: python3 tools/mkimage.py [--raw] <output> name=image.png [name=image.ppm ...]
+  e.g. python3 tools/mkimage.py oledDriver/oledC_imageData watchFace=art/face.png
+"""
+
+import os
+import struct
+import sys
+import zlib
+
+
+def read_ppm(path):
+    data = open(path, "rb").read()
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    magic, width, height, maxval = fields[0], int(fields[1]), int(fields[2]), int(fields[3])
+    if magic == b"P6" and maxval < 256:
+        raw = data[pos + 1:pos + 1 + width * height * 3]
+        values = list(raw)
+    elif magic == b"P3":
+        values = [int(v) for v in data[pos:].split()][:width * height * 3]
+    else:
+        sys.exit("%s: only P3 and 8-bit P6 files are supported" % path)
+    scale = 255.0 / maxval
+    pixels = [tuple(int(round(v * scale)) for v in values[i:i + 3]) for i in range(0, len(values), 3)]
+    return width, height, pixels
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    return b if pb <= pc else c
+
+
+def read_png(path):
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: not a PNG file" % path)
+    pos, idat, palette = 8, b"", []
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        pos += 12 + length
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    if depth != 8 or interlace:
+        sys.exit("%s: only 8-bit, non-interlaced PNG files are supported" % path)
+    raw, stride, prev, pixels = zlib.decompress(idat), width * channels, None, []
+    for y in range(height):
+        line = raw[y * (stride + 1):(y + 1) * (stride + 1)]
+        kind, row = line[0], bytearray(line[1:])
+        up = prev or bytearray(stride)
+        for i in range(stride):
+            left = row[i - channels] if i >= channels else 0
+            corner = up[i - channels] if i >= channels else 0
+            row[i] = (row[i] + [0, left, up[i], (left + up[i]) // 2, paeth(left, up[i], corner)][kind]) & 0xFF
+        prev = row
+        for x in range(width):
+            p = row[x * channels:(x + 1) * channels]
+            if ctype == 3:
+                pixels.append(palette[p[0]])
+            elif ctype in (0, 4):
+                pixels.append((p[0], p[0], p[0]))
+            else:
+                pixels.append(tuple(p[:3]))
+    return width, height, pixels
+
+
+def rgb565(pixel):
+    r, g, b = pixel
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def runs(colors):
+    out = []
+    for c in colors:
+        if out and out[-1][0] == c:
+            out[-1][1] += 1
+        else:
+            out.append([c, 1])
+    return out
+
+
+def encode_rle4(colors, palette):
+    index = {c: i for i, c in enumerate(palette)}
+    out = []
+    for color, count in runs(colors):
+        while count > 0:
+            take = min(count, 271)
+            if take < 16:
+                out.append(index[color] << 4 | take)
+            else:
+                out += [index[color] << 4, take - 16]
+            count -= take
+    return out
+
+
+def encode_rle565(colors):
+    out, literal = [], []
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(0x80 | (len(chunk) - 1))
+            for c in chunk:
+                out.extend([c >> 8, c & 0xFF])
+
+    for color, count in runs(colors):
+        if count == 1:
+            literal.append(color)
+            continue
+        flush()
+        while count > 0:
+            take = min(count, 128)
+            out += [take - 1, color >> 8, color & 0xFF]
+            count -= take
+    flush()
+    return out
+
+
+def c_array(ctype, name, values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ",".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "static const %s %s[%d] = {\n%s\n};\n" % (ctype, name, len(values), "\n".join(lines))
+
+
+def main():
+    args = sys.argv[1:]
+    raw_tables = bool(args) and args[0] == "--raw"
+    if raw_tables:
+        args = args[1:]
+    if len(args) < 2:
+        sys.exit(__doc__)
+    output, images = args[0], [arg.split("=", 1) for arg in args[1:]]
+    base = os.path.basename(output)
+    source = ["/*", " * File:   %s.c" % base, " *",
+              " * Generated by tools/mkimage.py - do not edit. The tables are const,",
+              " * so XC16 keeps them in program memory and reads them through PSV.",
+              " */", "", "#include <stdint.h>", "#include <stddef.h>", '#include "oledC_image.h"', ""]
+    header = ["/*", " * File:   %s.h" % base, " *", " * Generated by tools/mkimage.py - do not edit.", " */", "",
+              "#ifndef %s_H" % base.upper(), "#define\t%s_H" % base.upper(), "", '#include "oledC_image.h"', ""]
+
+    for name, path in images:
+        width, height, pixels = (read_png if path.lower().endswith(".png") else read_ppm)(path)
+        if width > 255 or height > 255:
+            sys.exit("%s: images are limited to 255x255" % path)
+        colors = [rgb565(p) for p in pixels]
+        palette = sorted(set(colors))
+        if len(palette) <= 16:
+            data, fmt = encode_rle4(colors, palette), "OLEDC_IMAGE_RLE4"
+            source.append(c_array("uint16_t", name + "Palette", palette, 8, "0x%04X"))
+            stored = len(data) + 2 * len(palette)
+        else:
+            data, fmt = encode_rle565(colors), "OLEDC_IMAGE_RLE565"
+            stored = len(data)
+        source.append(c_array("uint8_t", name + "Data", data, 16, "0x%02X"))
+        source.append("const oledc_image_t %s = { %d, %d, %s, %s, %sData };\n" % (
+            name, width, height, fmt, name + "Palette" if fmt == "OLEDC_IMAGE_RLE4" else "NULL", name))
+        header.append("extern const oledc_image_t %s;    /* %dx%d */" % (name, width, height))
+        if raw_tables:
+            source.append(c_array("uint16_t", name + "Raw", colors, 12, "0x%04X").replace("static ", "", 1))
+            header.append("extern const uint16_t %sRaw[%d];" % (name, len(colors)))
+        raw = width * height * 2
+        print("%-16s %3dx%-3d %-18s %6d bytes, raw RGB565 %6d (%.1f:1)" % (
+            name, width, height, fmt, stored, raw, float(raw) / stored), file=sys.stderr)
+
+    header += ["", "#endif\t/* %s_H */" % base.upper(), ""]
+    open(output + ".c", "w").write("\n".join(source))
+    open(output + ".h", "w").write("\n".join(header))
+
+
+if __name__ == "__main__":
+    main()
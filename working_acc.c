@@ -38,7 +38,7 @@ const float baselineGravity = 1024.0f;
 // ---------------- Error Handling ----------------
 void errorStop(char *msg)
 {
-    oledC_DrawString(0, 20, 1, 1, (uint8_t *)msg, OLEDC_COLOR_DARKRED);
+    oledC_DrawString(0, 20, 1, 1, (uint8_t *)msg, OLEDC_COLOR_DARKRED, NULL);
     printf("Error: %s\n", msg);
     for (;;)
         ;
@@ -146,8 +146,8 @@ void drawSteps(void)
 
     if (strcmp(oldStr, newStr) != 0)
     {
-        oledC_DrawString(80, 2, 1, 1, (uint8_t *)oldStr, OLEDC_COLOR_BLACK);
-        oledC_DrawString(80, 2, 1, 1, (uint8_t *)newStr, OLEDC_COLOR_WHITE);
+        oledC_DrawString(80, 2, 1, 1, (uint8_t *)oldStr, OLEDC_COLOR_BLACK, NULL);
+        oledC_DrawString(80, 2, 1, 1, (uint8_t *)newStr, OLEDC_COLOR_WHITE, NULL);
         strcpy(oldStr, newStr);
     }
 }
@@ -174,7 +174,7 @@ int main(void)
         DELAY_milliseconds(10);
     }
 
-    oledC_DrawString(0, 0, 1, 1, (uint8_t *)"ADXL345", OLEDC_COLOR_BLACK);
+    oledC_DrawString(0, 0, 1, 1, (uint8_t *)"ADXL345", OLEDC_COLOR_BLACK, NULL);
 
     // Initialize Accelerometer
     initAccelerometer();
@@ -192,22 +192,22 @@ int main(void)
         char buffer[32];
 
         sprintf(buffer, "X: %03d", abs(x) % 1000);
-        oledC_DrawString(20, 20, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK);
+        oledC_DrawString(20, 20, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK, NULL);
 
         sprintf(buffer, "Y: %03d", abs(y) % 1000);
-        oledC_DrawString(20, 40, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK);
+        oledC_DrawString(20, 40, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK, NULL);
 
         sprintf(buffer, "Z: %03d", abs(z) % 1000);
-        oledC_DrawString(20, 60, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK);
+        oledC_DrawString(20, 60, 1, 1, (uint8_t *)buffer, OLEDC_COLOR_BLACK, NULL);
 
         // Check if the device is upside down
         if (z < 0)
         {
-            oledC_DrawString(20, 80, 1, 1, (uint8_t *)"Upside Down!", OLEDC_COLOR_RED);
+            oledC_DrawString(20, 80, 1, 1, (uint8_t *)"Upside Down!", OLEDC_COLOR_RED, NULL);
         }
         else
         {
-            oledC_DrawString(20, 80, 1, 1, (uint8_t *)"Normal", OLEDC_COLOR_GREEN);
+            oledC_DrawString(20, 80, 1, 1, (uint8_t *)"Normal", OLEDC_COLOR_GREEN, NULL);
         }
 
         DELAY_milliseconds(500);